@@ -0,0 +1,461 @@
+#include "Asientos.h"
+#include <algorithm>
+#include <sstream>
+using namespace std;
+
+/**
+ * Constructor que prepara los asientos vacíos y la reserva de manos
+ */
+Asientos::Asientos(int numAsientos) : manosReservadas(0) {
+    size_t cantidad = static_cast<size_t>(clamp(numAsientos, 1, MAX_ASIENTOS));
+    size_t huecos = cantidad * MAX_MANOS;
+    totales.assign(huecos, 0);
+    suaves.assign(huecos, 0);
+    estados.assign(huecos, EstadoAsiento::VACIO);
+    manos.resize(huecos);
+    asientosMano.assign(huecos, 0);
+    apuestasMano.assign(huecos, 0);
+    for (size_t asiento = 0; asiento < cantidad; asiento++) {
+        asientosMano[asiento] = static_cast<uint8_t>(asiento);
+    }
+    titulares.assign(cantidad, -1);
+    numManosAsiento.assign(cantidad, 1);
+    primeraDivision.assign(cantidad, -1);
+}
+
+/**
+ * Sienta al titular en el primer asiento libre
+ */
+int Asientos::sentar(const string& nombre, Centavos dineroInicial) {
+    auto libre = find(titulares.begin(), titulares.end(), -1);
+    if (libre == titulares.end()) {
+        return -1;
+    }
+    int asiento = static_cast<int>(libre - titulares.begin());
+    int posicion = numPosiciones();
+    *libre = posicion;
+    estados[asiento] = EstadoAsiento::SIN_APUESTA;
+
+    asientosPosicion.push_back(static_cast<uint8_t>(asiento));
+    apuestas.push_back(0);
+    seguros.push_back(0);
+    dineros.push_back(dineroInicial);
+    nombres.push_back(nombre);
+    return posicion;
+}
+
+/**
+ * Agrega una posición que apuesta a la mano de otro
+ */
+int Asientos::agregarDetras(int asiento, const string& nombre, Centavos dineroInicial) {
+    if (asiento < 0 || asiento >= numAsientos() || titulares[asiento] < 0) {
+        return -1;
+    }
+    asientosPosicion.push_back(static_cast<uint8_t>(asiento));
+    apuestas.push_back(0);
+    seguros.push_back(0);
+    dineros.push_back(dineroInicial);
+    nombres.push_back(nombre);
+    return numPosiciones() - 1;
+}
+
+/**
+ * Compacta los arreglos por posición sin las del asiento y renumera los
+ * titulares que quedan
+ */
+bool Asientos::levantar(int asiento) {
+    if (asiento < 0 || asiento >= numAsientos() || titulares[asiento] < 0) {
+        return false;
+    }
+    vector<int> nuevaPosicion(asientosPosicion.size(), -1);
+    size_t destino = 0;
+    for (size_t posicion = 0; posicion < asientosPosicion.size(); posicion++) {
+        if (asientosPosicion[posicion] == asiento) {
+            continue;
+        }
+        nuevaPosicion[posicion] = static_cast<int>(destino);
+        if (destino != posicion) {
+            asientosPosicion[destino] = asientosPosicion[posicion];
+            apuestas[destino] = apuestas[posicion];
+            seguros[destino] = seguros[posicion];
+            dineros[destino] = dineros[posicion];
+            nombres[destino] = move(nombres[posicion]);
+        }
+        destino++;
+    }
+    asientosPosicion.resize(destino);
+    apuestas.resize(destino);
+    seguros.resize(destino);
+    dineros.resize(destino);
+    nombres.resize(destino);
+
+    titulares[asiento] = -1;
+    for (int& titular : titulares) {
+        titular = titular < 0 ? -1 : nuevaPosicion[titular];
+    }
+    manos[asiento].limpiar();
+    totales[asiento] = 0;
+    suaves[asiento] = 0;
+    estados[asiento] = EstadoAsiento::VACIO;
+    return true;
+}
+
+/**
+ * Descuenta la apuesta; una apuesta detrás exige que el titular haya apostado
+ */
+bool Asientos::apostar(int posicion, Centavos cantidad) {
+    if (cantidad <= 0 || cantidad > dineros[posicion] || cantidad > Dinero::APUESTA_MAXIMA) {
+        return false;
+    }
+    int asiento = asientosPosicion[posicion];
+    if (esTitular(posicion)) {
+        estados[asiento] = EstadoAsiento::JUGANDO;
+    } else if (apuestas[titulares[asiento]] <= 0) {
+        return false;
+    }
+    dineros[posicion] -= cantidad;
+    apuestas[posicion] = cantidad;
+    return true;
+}
+
+/**
+ * Suma el pago al dinero de la posición, con suma verificada
+ */
+bool Asientos::pagar(int posicion, Centavos cantidad) {
+    return Dinero::sumar(dineros[posicion], cantidad, dineros[posicion]);
+}
+
+/**
+ * Suma los retornos de la liquidación, en un solo recorrido; el saldo que
+ * desbordaría se conserva con una selección en lugar de un salto
+ */
+bool Asientos::pagarTodos(const vector<Centavos>& retornos) {
+    bool desbordado = false;
+    for (size_t i = 0; i < dineros.size(); i++) {
+        Centavos suma;
+        bool desborda = __builtin_add_overflow(dineros[i], retornos[i], &suma);
+        dineros[i] = desborda ? dineros[i] : suma;
+        desbordado |= desborda;
+    }
+    return !desbordado;
+}
+
+/**
+ * Copia al estado caliente el valor de la mano; en una mano dividida el 21
+ * con dos cartas no es Blackjack y se planta solo
+ */
+void Asientos::actualizarMano(int hueco) {
+    const Mano& mano = manos[hueco];
+    totales[hueco] = static_cast<uint8_t>(mano.calcularValor());
+    suaves[hueco] = mano.esSuave();
+    if (mano.sePaso()) {
+        estados[hueco] = EstadoAsiento::PASADO;
+    } else if (mano.esBlackjack()) {
+        estados[hueco] = numManosAsiento[asientosMano[hueco]] > 1 ? EstadoAsiento::PLANTADO : EstadoAsiento::BLACKJACK;
+    }
+}
+
+/**
+ * Agrega la carta y actualiza el estado caliente de la mano
+ */
+void Asientos::recibirCarta(int asiento, Carta carta, int mano) {
+    int hueco = indiceMano(asiento, mano);
+    manos[hueco].agregarCarta(carta);
+    actualizarMano(hueco);
+}
+
+/**
+ * Planta la mano si aún estaba jugando
+ */
+void Asientos::plantar(int asiento, int mano) {
+    int hueco = indiceMano(asiento, mano);
+    if (estados[hueco] == EstadoAsiento::JUGANDO) {
+        estados[hueco] = EstadoAsiento::PLANTADO;
+    }
+}
+
+/**
+ * Cobra al titular otra vez la apuesta de la mano; la mano doblada no pasa
+ * de Dinero::APUESTA_MAXIMA, para que su pago siga cabiendo en 64 bits
+ */
+bool Asientos::doblar(int asiento, int mano) {
+    int hueco = indiceMano(asiento, mano);
+    int titular = titulares[asiento];
+    Centavos apuesta = obtenerApuestaMano(asiento, mano);
+    if (estados[hueco] != EstadoAsiento::JUGANDO || manos[hueco].obtenerNumeroCartas() != 2 ||
+        apuesta > dineros[titular] || apuesta > Dinero::APUESTA_MAXIMA - apuesta) {
+        return false;
+    }
+    dineros[titular] -= apuesta;
+    if (mano == 0) {
+        apuestas[titular] += apuesta;
+    } else {
+        apuestasMano[hueco] += apuesta;
+    }
+    return true;
+}
+
+/**
+ * Toma el siguiente hueco de la reserva; solo el último asiento que dividió
+ * puede seguir dividiendo, para que sus manos queden contiguas
+ */
+bool Asientos::dividir(int asiento, int mano) {
+    int hueco = indiceMano(asiento, mano);
+    int titular = titulares[asiento];
+    Centavos apuesta = obtenerApuestaMano(asiento, mano);  // Una pareja aún no dobló: es la apuesta inicial
+    int divididas = numManosAsiento[asiento] - 1;
+    bool contiguo = divididas == 0 || primeraDivision[asiento] + divididas == numAsientos() + manosReservadas;
+    if (estados[hueco] != EstadoAsiento::JUGANDO || !manos[hueco].esPar() || divididas + 1 >= MAX_MANOS ||
+        !contiguo || apuesta > dineros[titular]) {
+        return false;
+    }
+
+    int nuevo = numAsientos() + manosReservadas;
+    if (divididas == 0) {
+        primeraDivision[asiento] = nuevo;
+    }
+    manosReservadas++;
+    numManosAsiento[asiento]++;
+    dineros[titular] -= apuesta;
+    apuestasMano[nuevo] = apuesta;
+    asientosMano[nuevo] = static_cast<uint8_t>(asiento);
+
+    Carta primera = manos[hueco].obtenerCartas()[0];
+    Carta segunda = manos[hueco].obtenerCartas()[1];
+    manos[hueco].limpiar();
+    manos[hueco].agregarCarta(primera);
+    manos[nuevo].limpiar();
+    manos[nuevo].agregarCarta(segunda);
+    estados[nuevo] = EstadoAsiento::JUGANDO;
+    actualizarMano(hueco);
+    actualizarMano(nuevo);
+    return true;
+}
+
+/**
+ * Solo la mano inicial, con dos cartas y sin dividir
+ */
+bool Asientos::rendirse(int asiento) {
+    if (estados[asiento] != EstadoAsiento::JUGANDO || numManosAsiento[asiento] != 1 ||
+        manos[asiento].obtenerNumeroCartas() != 2) {
+        return false;
+    }
+    estados[asiento] = EstadoAsiento::RENDIDO;
+    return true;
+}
+
+/**
+ * El seguro cuesta la mitad de la apuesta, redondeada hacia abajo al centavo
+ */
+bool Asientos::asegurar(int posicion) {
+    Centavos seguro = apuestas[posicion] / 2;
+    if (seguro <= 0 || seguros[posicion] > 0 || seguro > dineros[posicion]) {
+        return false;
+    }
+    dineros[posicion] -= seguro;
+    seguros[posicion] = seguro;
+    return true;
+}
+
+/**
+ * Limpia manos, apuestas y seguros, y libera la reserva
+ */
+void Asientos::reiniciarRonda() {
+    for (int asiento = 0; asiento < numAsientos(); asiento++) {
+        manos[asiento].limpiar();
+        totales[asiento] = 0;
+        suaves[asiento] = 0;
+        estados[asiento] = titulares[asiento] < 0 ? EstadoAsiento::VACIO : EstadoAsiento::SIN_APUESTA;
+        numManosAsiento[asiento] = 1;
+        primeraDivision[asiento] = -1;
+    }
+    for (int hueco = numAsientos(); hueco < numAsientos() + manosReservadas; hueco++) {
+        manos[hueco].limpiar();
+        totales[hueco] = 0;
+        suaves[hueco] = 0;
+        estados[hueco] = EstadoAsiento::VACIO;
+        apuestasMano[hueco] = 0;
+    }
+    manosReservadas = 0;
+    fill(apuestas.begin(), apuestas.end(), 0);
+    fill(seguros.begin(), seguros.end(), 0);
+}
+
+/**
+ * Verifica si la posición es el titular de su asiento
+ */
+bool Asientos::esTitular(int posicion) const {
+    return titulares[asientosPosicion[posicion]] == posicion;
+}
+
+/**
+ * Cuenta las posiciones anteriores del mismo asiento; el titular siempre
+ * entra antes que quienes apuestan detrás de él
+ */
+int Asientos::ordenEnAsiento(int posicion) const {
+    return static_cast<int>(count(asientosPosicion.begin(), asientosPosicion.begin() + posicion,
+                                  asientosPosicion[posicion]));
+}
+
+/**
+ * Información de una posición, con el mismo formato que Jugador::obtenerInfo
+ */
+string Asientos::obtenerInfo(int posicion) const {
+    stringstream ss;
+    ss << "Jugador: " << nombres[posicion] << " | Dinero: $" << Dinero::formatear(dineros[posicion]);
+    if (apuestas[posicion] > 0) {
+        ss << " | Apuesta actual: $" << Dinero::formatear(apuestas[posicion]);
+    }
+    return ss.str();
+}
+
+/**
+ * Getter del número de asientos
+ */
+int Asientos::numAsientos() const {
+    return static_cast<int>(titulares.size());
+}
+
+/**
+ * Getter del número de posiciones
+ */
+int Asientos::numPosiciones() const {
+    return static_cast<int>(apuestas.size());
+}
+
+/**
+ * Getter del titular de un asiento
+ */
+int Asientos::obtenerTitular(int asiento) const {
+    return titulares[asiento];
+}
+
+/**
+ * Getter del asiento de una posición
+ */
+int Asientos::obtenerAsiento(int posicion) const {
+    return asientosPosicion[posicion];
+}
+
+/**
+ * Getter del nombre de una posición
+ */
+const string& Asientos::obtenerNombre(int posicion) const {
+    return nombres[posicion];
+}
+
+/**
+ * Getter de la apuesta de una posición
+ */
+Centavos Asientos::obtenerApuesta(int posicion) const {
+    return apuestas[posicion];
+}
+
+/**
+ * Getter del dinero de una posición
+ */
+Centavos Asientos::obtenerDinero(int posicion) const {
+    return dineros[posicion];
+}
+
+/**
+ * Getter del seguro de una posición
+ */
+Centavos Asientos::obtenerSeguro(int posicion) const {
+    return seguros[posicion];
+}
+
+/**
+ * Getter del estado de una mano
+ */
+EstadoAsiento Asientos::obtenerEstado(int asiento, int mano) const {
+    return estados[indiceMano(asiento, mano)];
+}
+
+/**
+ * Getter del total de una mano
+ */
+int Asientos::obtenerTotal(int asiento, int mano) const {
+    return totales[indiceMano(asiento, mano)];
+}
+
+/**
+ * Getter de la suavidad de una mano
+ */
+bool Asientos::esSuave(int asiento, int mano) const {
+    return suaves[indiceMano(asiento, mano)] != 0;
+}
+
+/**
+ * Getter de las cartas de una mano
+ */
+const Mano& Asientos::obtenerMano(int asiento, int mano) const {
+    return manos[indiceMano(asiento, mano)];
+}
+
+/**
+ * La primera mano apuesta lo del titular; las divididas, lo suyo
+ */
+Centavos Asientos::obtenerApuestaMano(int asiento, int mano) const {
+    return mano == 0 ? apuestas[titulares[asiento]] : apuestasMano[indiceMano(asiento, mano)];
+}
+
+/**
+ * Getter del número de manos de un asiento
+ */
+int Asientos::numManos(int asiento) const {
+    return numManosAsiento[asiento];
+}
+
+/**
+ * La primera mano está en el hueco del asiento; las divididas, seguidas en la reserva
+ */
+int Asientos::indiceMano(int asiento, int mano) const {
+    return mano == 0 ? asiento : primeraDivision[asiento] + mano - 1;
+}
+
+/**
+ * Huecos de mano en uso
+ */
+int Asientos::numManosEnUso() const {
+    return numAsientos() + manosReservadas;
+}
+
+/**
+ * Getters de los arreglos completos
+ */
+const vector<uint8_t>& Asientos::obtenerTotales() const {
+    return totales;
+}
+
+const vector<uint8_t>& Asientos::obtenerSuaves() const {
+    return suaves;
+}
+
+const vector<EstadoAsiento>& Asientos::obtenerEstados() const {
+    return estados;
+}
+
+const vector<uint8_t>& Asientos::obtenerAsientosMano() const {
+    return asientosMano;
+}
+
+const vector<Centavos>& Asientos::obtenerApuestasMano() const {
+    return apuestasMano;
+}
+
+const vector<uint8_t>& Asientos::obtenerAsientosPosicion() const {
+    return asientosPosicion;
+}
+
+const vector<Centavos>& Asientos::obtenerApuestas() const {
+    return apuestas;
+}
+
+const vector<Centavos>& Asientos::obtenerSeguros() const {
+    return seguros;
+}
+
+const vector<Centavos>& Asientos::obtenerDineros() const {
+    return dineros;
+}
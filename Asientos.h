@@ -0,0 +1,266 @@
+#ifndef ASIENTOS_H
+#define ASIENTOS_H
+
+#include "ConjuntoReglas.h"
+#include "Dinero.h"
+#include "Mano.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * @enum EstadoAsiento
+ * @brief Estado de la mano de un asiento durante la ronda
+ */
+enum class EstadoAsiento : uint8_t {
+    VACIO,        ///< Nadie está sentado
+    SIN_APUESTA,  ///< El titular no apostó esta ronda
+    JUGANDO,      ///< La mano puede pedir carta
+    PLANTADO,     ///< El titular se plantó
+    PASADO,       ///< La mano pasó de 21
+    BLACKJACK,    ///< As y figura en las dos primeras cartas (nunca en una mano dividida)
+    RENDIDO       ///< El titular se rindió y recupera media apuesta
+};
+
+/**
+ * @class Asientos
+ * @brief Estado de todos los asientos de una mesa en forma de estructura de arreglos
+ *
+ * Cada asiento tiene una mano, que juega su titular. Además del titular,
+ * cualquier número de apostadores "detrás" puede apostar a la mano de un
+ * asiento sin tomar decisiones. Titulares y apostadores detrás son
+ * posiciones: cada posición tiene apuesta, seguro, dinero y el asiento al
+ * que apuesta, guardados en arreglos paralelos. Por mano se guardan el
+ * total, si es suave y el estado, de modo que las fases de la ronda
+ * recorren memoria contigua. Nombres y cartas solo se usan para mostrar.
+ *
+ * Las manos ocupan huecos fijos: el hueco i < numAsientos() es la primera
+ * mano del asiento i, y detrás viene una reserva de la mesa con
+ * (MAX_MANOS - 1) huecos por asiento para las manos divididas. Dividir toma
+ * el siguiente hueco libre de la reserva, así que nunca reserva memoria.
+ * Como los asientos juegan en orden, las manos divididas de un asiento
+ * quedan contiguas. Las apuestas detrás siguen solo a la primera mano: no
+ * doblan ni dividen, pero sí se rinden con ella.
+ */
+class Asientos {
+public:
+    static constexpr int MAX_ASIENTOS = 255;  ///< El historial reserva el asiento 0xFF al crupier
+    static constexpr int MAX_MANOS = ConfiguracionReglas::MAX_MANOS;  ///< Manos por asiento tras dividir
+
+private:
+    // Por hueco de mano: primero una por asiento y después la reserva para divisiones
+    vector<uint8_t> totales;            ///< Valor de la mano
+    vector<uint8_t> suaves;             ///< 1 si la mano es suave
+    vector<EstadoAsiento> estados;      ///< Estado de la mano
+    vector<Mano> manos;                 ///< Cartas de la mano
+    vector<uint8_t> asientosMano;       ///< Asiento dueño de cada hueco
+    vector<Centavos> apuestasMano;      ///< Apuesta del titular en las manos de la reserva
+    int manosReservadas;                ///< Huecos de la reserva usados en la ronda
+
+    // Por asiento
+    vector<int> titulares;              ///< Posición del titular, -1 si está vacío
+    vector<uint8_t> numManosAsiento;    ///< Manos del asiento en la ronda
+    vector<int> primeraDivision;        ///< Hueco de la primera mano dividida del asiento
+
+    // Por posición
+    vector<uint8_t> asientosPosicion;   ///< Asiento al que apuesta la posición
+    vector<Centavos> apuestas;          ///< Apuesta de la ronda en la primera mano (0 si no apostó)
+    vector<Centavos> seguros;           ///< Seguro contra el Blackjack del crupier (0 si no tomó)
+    vector<Centavos> dineros;           ///< Dinero disponible
+    vector<string> nombres;             ///< Nombre del jugador
+
+    /**
+     * @brief Recalcula total, suavidad y estado de un hueco a partir de su mano
+     * @param hueco Hueco de la mano
+     */
+    void actualizarMano(int hueco);
+
+public:
+    /**
+     * @brief Constructor de la clase Asientos
+     * @param numAsientos Número de asientos (1 a MAX_ASIENTOS)
+     */
+    explicit Asientos(int numAsientos = 7);
+
+    /**
+     * @brief Sienta un titular en el primer asiento libre
+     * @param nombre Nombre del jugador
+     * @param dineroInicial Dinero inicial, en centavos
+     * @return Posición del jugador, o -1 si no hay asientos libres
+     * @pre Solo entre rondas: agregar una posición reubica los datos por
+     *      posición, a los que una ronda en curso puede apuntar
+     */
+    int sentar(const string& nombre, Centavos dineroInicial);
+
+    /**
+     * @brief Agrega un apostador detrás de un asiento ocupado
+     * @param asiento Asiento a cuya mano apuesta
+     * @param nombre Nombre del jugador
+     * @param dineroInicial Dinero inicial, en centavos
+     * @return Posición del jugador, o -1 si el asiento no tiene titular
+     * @pre Solo entre rondas, como sentar
+     */
+    int agregarDetras(int asiento, const string& nombre, Centavos dineroInicial);
+
+    /**
+     * @brief Libera un asiento
+     * @param asiento Asiento a liberar
+     * @return false si el asiento no es válido o ya estaba vacío
+     * @pre Solo entre rondas: ninguna posición tiene apuesta
+     * @post Se quitan el titular y quienes apuestan detrás; las demás
+     *       posiciones conservan su orden, aunque pueden cambiar de índice
+     */
+    bool levantar(int asiento);
+
+    /**
+     * @brief Registra la apuesta de una posición
+     * @param posicion Posición que apuesta
+     * @param cantidad Cantidad apostada, en centavos
+     * @return false si no tiene dinero suficiente, si supera Dinero::APUESTA_MAXIMA
+     *         o, detrás, si el titular no apostó
+     * @post Si el titular apuesta, su mano pasa a JUGANDO
+     */
+    bool apostar(int posicion, Centavos cantidad);
+
+    /**
+     * @brief Suma dinero a una posición
+     * @param posicion Posición que cobra
+     * @param cantidad Cantidad cobrada, en centavos
+     * @return false si el saldo desbordaría; en ese caso no cambia
+     */
+    bool pagar(int posicion, Centavos cantidad);
+
+    /**
+     * @brief Suma a cada posición su retorno
+     * @param retornos Un retorno por posición
+     * @return false si algún saldo desbordaría; esos saldos no cambian
+     * @pre retornos tiene numPosiciones() elementos
+     */
+    bool pagarTodos(const vector<Centavos>& retornos);
+
+    /**
+     * @brief Agrega una carta a una mano de un asiento
+     * @param asiento Asiento que recibe la carta
+     * @param carta Carta recibida
+     * @param mano Índice de la mano dentro del asiento
+     * @post Se actualizan total, suavidad y estado (PASADO o BLACKJACK; un 21
+     *       con dos cartas de una mano dividida queda PLANTADO)
+     */
+    void recibirCarta(int asiento, Carta carta, int mano = 0);
+
+    /**
+     * @brief Planta una mano de un asiento
+     * @param asiento Asiento que se planta
+     * @param mano Índice de la mano dentro del asiento
+     */
+    void plantar(int asiento, int mano = 0);
+
+    /**
+     * @brief Dobla la apuesta del titular en una mano
+     * @param asiento Asiento del titular
+     * @param mano Índice de la mano dentro del asiento
+     * @return false si la mano no tiene dos cartas, si el titular no tiene
+     *         dinero o si la apuesta doblada pasaría de Dinero::APUESTA_MAXIMA
+     * @post La apuesta de la mano se duplica; quien reparte le da una sola
+     *       carta más y la planta
+     */
+    bool doblar(int asiento, int mano);
+
+    /**
+     * @brief Divide una pareja en dos manos
+     * @param asiento Asiento del titular
+     * @param mano Índice de la mano dentro del asiento
+     * @return false si la mano no es pareja, si el asiento ya tiene MAX_MANOS,
+     *         si el titular no tiene dinero o si otro asiento dividió después
+     * @post La segunda carta pasa a una mano nueva al final del asiento, con la
+     *       apuesta inicial; ambas manos quedan con una carta, JUGANDO
+     */
+    bool dividir(int asiento, int mano);
+
+    /**
+     * @brief Rinde la mano inicial de un asiento
+     * @param asiento Asiento del titular
+     * @return false si el asiento ya dividió o la mano no tiene dos cartas
+     * @post La mano queda RENDIDO, también para quienes apuestan detrás
+     */
+    bool rendirse(int asiento);
+
+    /**
+     * @brief Toma el seguro de una posición: la mitad de su apuesta
+     * @param posicion Posición que se asegura
+     * @return false si no apostó, ya tiene seguro o no le alcanza el dinero
+     * @post El seguro paga 2:1 si el crupier tiene Blackjack
+     */
+    bool asegurar(int posicion);
+
+    /**
+     * @brief Limpia manos, apuestas y seguros para una nueva ronda
+     * @post Los asientos ocupados quedan SIN_APUESTA y la reserva de manos, libre
+     */
+    void reiniciarRonda();
+
+    /**
+     * @brief Verifica si la posición es el titular de su asiento
+     * @param posicion Posición a verificar
+     * @return true si es titular, false si apuesta detrás
+     */
+    bool esTitular(int posicion) const;
+
+    /**
+     * @brief Obtiene el orden de una posición entre las de su asiento
+     * @param posicion Posición a consultar
+     * @return 0 para el titular, k para el k-ésimo que apuesta detrás
+     */
+    int ordenEnAsiento(int posicion) const;
+
+    /**
+     * @brief Obtiene información de una posición
+     * @param posicion Posición
+     * @return Texto con nombre, dinero y apuesta
+     */
+    string obtenerInfo(int posicion) const;
+
+    // Getters
+    int numAsientos() const;
+    int numPosiciones() const;
+    int obtenerTitular(int asiento) const;
+    int obtenerAsiento(int posicion) const;
+    const string& obtenerNombre(int posicion) const;
+    Centavos obtenerApuesta(int posicion) const;
+    Centavos obtenerDinero(int posicion) const;
+    Centavos obtenerSeguro(int posicion) const;
+    EstadoAsiento obtenerEstado(int asiento, int mano = 0) const;
+    int obtenerTotal(int asiento, int mano = 0) const;
+    bool esSuave(int asiento, int mano = 0) const;
+    const Mano& obtenerMano(int asiento, int mano = 0) const;
+    Centavos obtenerApuestaMano(int asiento, int mano = 0) const;
+    int numManos(int asiento) const;
+
+    /**
+     * @brief Obtiene el hueco que ocupa una mano
+     * @param asiento Asiento
+     * @param mano Índice de la mano dentro del asiento
+     * @return Índice en los arreglos por mano
+     */
+    int indiceMano(int asiento, int mano) const;
+
+    /**
+     * @brief Obtiene el número de huecos de mano en uso
+     * @return numAsientos() más las manos divididas de la ronda
+     */
+    int numManosEnUso() const;
+
+    // Arreglos completos, para recorridos por lotes
+    const vector<uint8_t>& obtenerTotales() const;
+    const vector<uint8_t>& obtenerSuaves() const;
+    const vector<EstadoAsiento>& obtenerEstados() const;
+    const vector<uint8_t>& obtenerAsientosMano() const;
+    const vector<Centavos>& obtenerApuestasMano() const;
+    const vector<uint8_t>& obtenerAsientosPosicion() const;
+    const vector<Centavos>& obtenerApuestas() const;
+    const vector<Centavos>& obtenerSeguros() const;
+    const vector<Centavos>& obtenerDineros() const;
+};
+
+#endif // ASIENTOS_H
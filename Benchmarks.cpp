@@ -0,0 +1,298 @@
+
+#include "Carta.h"
+#include "Mazo.h"
+#include "Mano.h"
+#include "Jugador.h"
+#include "Crupier.h"
+#include "Asientos.h"
+#include "Liquidacion.h"
+#include "EvaluadorManos.h"
+#include "Simulador.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * Contador global de reservas de memoria
+ * Se reemplazan los operadores new/delete para medir reservas por operación
+ */
+static atomic<uint64_t> reservasMemoria{0};
+
+void* operator new(size_t tamano) {
+    reservasMemoria.fetch_add(1, memory_order_relaxed);
+    if (void* puntero = malloc(tamano ? tamano : 1)) {
+        return puntero;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* puntero) noexcept {
+    free(puntero);
+}
+
+void operator delete(void* puntero, size_t) noexcept {
+    free(puntero);
+}
+
+/**
+ * @brief Impide que el compilador elimine un cálculo cuyo resultado no se usa
+ */
+template <typename T>
+inline void noOptimizar(const T& valor) {
+    asm volatile("" : : "r,m"(valor) : "memory");
+}
+
+/**
+ * @brief Clase para ejecutar los benchmarks del proyecto Blackjack
+ *
+ * Cada benchmark repite una operación hasta acumular un tiempo mínimo y
+ * reporta nanosegundos por operación, operaciones por segundo y reservas
+ * de memoria por operación, en formato legible y en CSV.
+ */
+class Benchmarks {
+private:
+    /**
+     * @brief Resultado de un benchmark
+     */
+    struct Medicion {
+        string nombre;
+        uint64_t operaciones;
+        double nsPorOperacion;
+        double reservasPorOperacion;
+    };
+
+    vector<Medicion> mediciones;
+    double segundosMinimos = 0.2;
+
+    /**
+     * @brief Mide una operación
+     * @param nombre Nombre del benchmark
+     * @param operacionesPorLote Operaciones que ejecuta cada llamada a lote
+     * @param lote Función que ejecuta operacionesPorLote operaciones
+     */
+    void medir(const string& nombre, uint64_t operacionesPorLote, function<void()> lote) {
+        lote();  // Calentamiento: cachés, reservas iniciales de vectores
+
+        uint64_t lotes = 1;
+        for (;;) {
+            uint64_t reservasAntes = reservasMemoria.load(memory_order_relaxed);
+            auto inicio = chrono::steady_clock::now();
+            for (uint64_t i = 0; i < lotes; i++) {
+                lote();
+            }
+            chrono::duration<double> duracion = chrono::steady_clock::now() - inicio;
+            uint64_t reservas = reservasMemoria.load(memory_order_relaxed) - reservasAntes;
+
+            if (duracion.count() >= segundosMinimos) {
+                uint64_t operaciones = lotes * operacionesPorLote;
+                mediciones.push_back({nombre, operaciones, duracion.count() * 1e9 / operaciones,
+                                      static_cast<double>(reservas) / operaciones});
+                return;
+            }
+            lotes *= 2;
+        }
+    }
+
+    /**
+     * @brief Benchmarks de las operaciones básicas de carta, mano y mazo
+     */
+    void benchmarksMicro() {
+        Mazo zapato(6);
+        vector<Carta> cartas;
+        while (!zapato.estaVacio()) {
+            cartas.push_back(zapato.repartirCarta());
+        }
+
+        medir("Carta::obtenerValorNumerico", cartas.size(), [&]() {
+            int suma = 0;
+            for (const Carta& carta : cartas) {
+                noOptimizar(carta);
+                suma += carta.obtenerValorNumerico();
+            }
+            noOptimizar(suma);
+        });
+
+        Mano mano;
+        mano.agregarCarta(Carta("A", "Picas"));
+        mano.agregarCarta(Carta("5", "Corazones"));
+        mano.agregarCarta(Carta("K", "Tréboles"));
+        const Mano* manoMedida = &mano;
+        noOptimizar(manoMedida);
+
+        medir("Mano::calcularValor", 1000, [&]() {
+            for (int i = 0; i < 1000; i++) {
+                noOptimizar(manoMedida);
+                int valor = manoMedida->calcularValor();
+                noOptimizar(valor);
+            }
+        });
+
+        medir("Mano::toString", 100, [&]() {
+            for (int i = 0; i < 100; i++) {
+                string texto = mano.toString();
+                noOptimizar(texto.size());
+            }
+        });
+
+        medir("Mazo::barajar (6 barajas)", 1, [&]() {
+            zapato.barajar();
+        });
+
+        medir("Mazo::repartirCarta", 1000, [&]() {
+            for (int i = 0; i < 1000; i++) {
+                if (zapato.estaVacio()) {
+                    zapato.reiniciar();
+                }
+                Carta carta = zapato.repartirCarta();
+                noOptimizar(carta);
+            }
+        });
+
+        medir("Mazo::cuentaVerdadera (4 sistemas)", 1000, [&]() {
+            double suma = 0;
+            for (int i = 0; i < 1000; i++) {
+                noOptimizar(zapato);
+                suma += zapato.cuentaVerdadera(static_cast<SistemaConteo>(i % Conteo::NUM_SISTEMAS));
+            }
+            noOptimizar(suma);
+        });
+
+        Crupier crupier(6);
+        Jugador jugador("Benchmark");
+        crupier.recibirCarta(Carta("10", "Picas"));
+        crupier.recibirCarta(Carta("7", "Picas"));
+        jugador.recibirCarta(Carta("9", "Corazones"));
+        jugador.recibirCarta(Carta("9", "Diamantes"));
+        const Jugador* jugadorMedido = &jugador;
+
+        medir("Crupier::determinarGanador", 1000, [&]() {
+            for (int i = 0; i < 1000; i++) {
+                noOptimizar(jugadorMedido);
+                int resultado = crupier.determinarGanador(jugadorMedido);
+                noOptimizar(resultado);
+            }
+        });
+
+        // Mesa comunitaria: 7 asientos con 29 apuestas detrás cada uno
+        Asientos asientos(7);
+        for (int asiento = 0; asiento < 7; asiento++) {
+            asientos.sentar("Titular", 100000);
+        }
+        for (int i = 0; i < 7 * 29; i++) {
+            asientos.agregarDetras(i % 7, "Detras", 100000);
+        }
+        for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+            asientos.apostar(posicion, 1000);
+        }
+        for (int asiento = 0; asiento < 7; asiento++) {
+            asientos.recibirCarta(asiento, Carta("10", "Picas"));
+            asientos.recibirCarta(asiento, cartas[asiento]);
+            asientos.plantar(asiento);
+        }
+        Liquidacion liquidacion;
+
+        medir("Liquidacion::liquidar (210 posiciones)", static_cast<uint64_t>(asientos.numPosiciones()), [&]() {
+            liquidacion.liquidar(asientos, crupier.obtenerMano());
+            noOptimizar(liquidacion.obtenerRetornos().data());
+        });
+
+        // Lote de manos de 2 a 5 cartas: una a una con Mano contra el núcleo por lotes
+        vector<Mano> manos(4096);
+        for (size_t i = 0; i < manos.size(); i++) {
+            for (size_t c = 0; c < 2 + i % 4; c++) {
+                manos[i].agregarCarta(cartas[(i * 5 + c) % cartas.size()]);
+            }
+        }
+        EvaluadorManos evaluador;
+        evaluador.cargar(manos);
+
+        medir("Mano una a una (4096 manos)", manos.size(), [&]() {
+            int suma = 0;
+            for (const Mano& m : manos) {
+                noOptimizar(m);
+                suma += m.calcularValor() + m.esBlackjack();
+            }
+            noOptimizar(suma);
+        });
+
+        medir(string("EvaluadorManos (4096 manos, ") + (EvaluadorManos::admiteAVX2() ? "AVX2)" : "escalar)"),
+              manos.size(), [&]() {
+            evaluador.evaluar();
+            noOptimizar(evaluador.obtenerTotales().data());
+        });
+    }
+
+    /**
+     * @brief Benchmarks de rondas completas sin interfaz con 1 a 7 jugadores
+     */
+    void benchmarksMacro() {
+        for (int jugadores = 1; jugadores <= 7; jugadores++) {
+            ConfiguracionSimulacion config;
+            config.estrategias.assign(jugadores, EstrategiaBasica());
+            Simulador simulador(config);
+            medir("Ronda sin interfaz (" + to_string(jugadores) + " jugadores)", 1000, [&]() {
+                ResultadoSimulacion resultado = simulador.ejecutar(1000);
+                noOptimizar(resultado.gananciaNeta);
+            });
+        }
+
+        ConfiguracionSimulacion config;
+        config.reglas.crupierPideSuave17 = true;
+        config.reglas.rendicionTardia = true;
+        config.reglas.pagoBlackjack = PagoBlackjack::SEIS_A_CINCO;
+        config.estrategias.assign(7, EstrategiaBasica());
+        Simulador simulador(config);
+        medir("Ronda sin interfaz (7 jugadores, H17 RS 6:5)", 1000, [&]() {
+            ResultadoSimulacion resultado = simulador.ejecutar(1000);
+            noOptimizar(resultado.gananciaNeta);
+        });
+    }
+
+public:
+    /**
+     * @brief Ejecuta todos los benchmarks y muestra los resultados
+     */
+    void ejecutarTodos() {
+        cout << "\n========================================" << endl;
+        cout << "           EJECUTANDO BENCHMARKS" << endl;
+        cout << "========================================" << endl;
+
+        benchmarksMicro();
+        benchmarksMacro();
+
+        cout << left << setw(42) << "Benchmark" << right << setw(14) << "ns/op"
+             << setw(16) << "ops/s" << setw(14) << "reservas/op" << "\n";
+        for (const Medicion& m : mediciones) {
+            cout << left << setw(42) << m.nombre << right << fixed
+                 << setw(14) << setprecision(2) << m.nsPorOperacion
+                 << setw(16) << setprecision(0) << 1e9 / m.nsPorOperacion
+                 << setw(14) << setprecision(4) << m.reservasPorOperacion << "\n";
+        }
+
+        cout << "\n--- CSV ---\n";
+        cout << "benchmark,operaciones,ns_por_op,ops_por_seg,reservas_por_op\n";
+        for (const Medicion& m : mediciones) {
+            cout << '"' << m.nombre << "\"," << m.operaciones << ','
+                 << setprecision(3) << m.nsPorOperacion << ','
+                 << setprecision(0) << 1e9 / m.nsPorOperacion << ','
+                 << setprecision(6) << m.reservasPorOperacion << '\n';
+        }
+        cout.flush();
+    }
+};
+
+/**
+ * @brief Función principal para ejecutar los benchmarks
+ */
+int main() {
+    Benchmarks benchmarks;
+    benchmarks.ejecutarTodos();
+    return 0;
+}
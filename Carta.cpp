@@ -1,24 +1,39 @@
 #include "Carta.h"
 using namespace std;
 
+namespace {
+    // Nombres para mostrar, indexados por el rango y el palo codificados
+    const char* const NOMBRES_VALORES[Carta::NUM_RANGOS] = {
+        "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"
+    };
+    const char* const NOMBRES_PALOS[Carta::NUM_PALOS] = {
+        "Corazones", "Diamantes", "Tréboles", "Picas"
+    };
+}
+
 /**
  * Constructor que inicializa una carta con su valor y palo
+ * Los strings solo se comparan aquí; la carta se guarda codificada en un byte
  */
-Carta::Carta(const string& valor, const string& palo) : valor(valor), palo(palo) {}
+Carta::Carta(const string& valor, const string& palo) : codigo(CODIGO_INVALIDO) {
+    uint8_t rango = NUM_RANGOS;
+    uint8_t indicePalo = NUM_PALOS;
 
-/**
- * Calcula el valor numérico de la carta según las reglas de Blackjack
- * - As vale 11 (el ajuste a 1 se maneja en la clase Mano)
- * - Figuras (J, Q, K) valen 10
- * - Cartas numéricas valen su número
- */
-int Carta::obtenerValorNumerico() const {
-    if (valor == "A") {
-        return 11;  // Por defecto, el As vale 11
-    } else if (valor == "J" || valor == "Q" || valor == "K") {
-        return 10;  // Todas las figuras valen 10
-    } else {
-        return stoi(valor);  // Cartas numéricas valen su número
+    for (uint8_t i = 0; i < NUM_RANGOS; i++) {
+        if (valor == NOMBRES_VALORES[i]) {
+            rango = i;
+            break;
+        }
+    }
+    for (uint8_t i = 0; i < NUM_PALOS; i++) {
+        if (palo == NOMBRES_PALOS[i]) {
+            indicePalo = i;
+            break;
+        }
+    }
+
+    if (rango < NUM_RANGOS && indicePalo < NUM_PALOS) {
+        codigo = static_cast<uint8_t>((indicePalo << 4) | rango);
     }
 }
 
@@ -26,26 +41,19 @@ int Carta::obtenerValorNumerico() const {
  * Getter para el valor de la carta
  */
 string Carta::obtenerValor() const {
-    return valor;
+    return esValida() ? NOMBRES_VALORES[obtenerRango()] : "?";
 }
 
 /**
  * Getter para el palo de la carta
  */
 string Carta::obtenerPalo() const {
-    return palo;
-}
-
-/**
- * Verifica si la carta es un As
- */
-bool Carta::esAs() const {
-    return valor == "A";
+    return esValida() ? NOMBRES_PALOS[obtenerIndicePalo()] : "?";
 }
 
 /**
  * Convierte la carta a una representación legible
  */
 string Carta::toString() const {
-    return valor + " de " + palo;
-}
\ No newline at end of file
+    return obtenerValor() + " de " + obtenerPalo();
+}
@@ -1,22 +1,52 @@
 #ifndef CARTA_H
 #define CARTA_H
 
+#include <cstdint>
 #include <string>
 using namespace std;
 
 /**
  * @class Carta
  * @brief Representa una carta individual del juego de Blackjack
- * 
+ *
  * Esta clase encapsula la información de una carta, incluyendo su valor y palo.
  * Implementa la lógica específica para el cálculo del valor en Blackjack.
+ *
+ * La carta se almacena empaquetada en un solo byte: los 4 bits bajos guardan
+ * el rango (0 = As ... 12 = K) y los bits 4-5 el palo. El valor numérico se
+ * obtiene de una tabla constexpr, sin comparar strings.
  */
 class Carta {
+public:
+    static constexpr uint8_t NUM_RANGOS = 13;      ///< A, 2-10, J, Q, K
+    static constexpr uint8_t NUM_PALOS = 4;        ///< Corazones, Diamantes, Tréboles, Picas
+    static constexpr uint8_t CODIGO_INVALIDO = 0xFF; ///< Código de una carta no válida
+    static constexpr uint8_t NUM_VALORES = 10;     ///< Valores distintos: A, 2-9 y 10/J/Q/K
+
 private:
-    string valor;  ///< Valor de la carta (A, 2-10, J, Q, K)
-    string palo;   ///< Palo de la carta (Corazones, Diamantes, Tréboles, Picas)
+    /// Valor numérico de cada rango según las reglas de Blackjack (As = 11)
+    static constexpr uint8_t VALORES_NUMERICOS[NUM_RANGOS] = {
+        11, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10
+    };
+
+    uint8_t codigo;  ///< Rango en los bits 0-3, palo en los bits 4-5
 
 public:
+    /**
+     * @brief Constructor por defecto
+     * @post Crea una carta inválida (esValida() retorna false)
+     */
+    constexpr Carta() : codigo(CODIGO_INVALIDO) {}
+
+    /**
+     * @brief Constructor a partir del rango y el palo codificados
+     * @param rango Rango de la carta (0 = As, 1-9 = 2-10, 10 = J, 11 = Q, 12 = K)
+     * @param palo Palo de la carta (0-3)
+     * @pre rango < NUM_RANGOS y palo < NUM_PALOS
+     */
+    constexpr Carta(uint8_t rango, uint8_t palo)
+        : codigo(static_cast<uint8_t>((palo << 4) | rango)) {}
+
     /**
      * @brief Constructor de la clase Carta
      * @param valor Valor de la carta
@@ -28,10 +58,45 @@ public:
 
     /**
      * @brief Obtiene el valor numérico de la carta para Blackjack
-     * @return Valor numérico de la carta (1-11)
+     * @return Valor numérico de la carta (2-11), o 0 si la carta no es válida
      * @post Retorna el valor correspondiente según las reglas de Blackjack
      */
-    int obtenerValorNumerico() const;
+    constexpr int obtenerValorNumerico() const {
+        // El código inválido tiene rango 15, fuera de la tabla
+        return esValida() ? VALORES_NUMERICOS[obtenerRango()] : 0;
+    }
+
+    /**
+     * @brief Obtiene el rango codificado de la carta
+     * @return Rango (0 = As ... 12 = K)
+     */
+    constexpr uint8_t obtenerRango() const { return codigo & 0x0F; }
+
+    /**
+     * @brief Obtiene el índice del valor de Blackjack de la carta
+     * @return 0 para el As, 1-8 para 2-9 y 9 para 10, J, Q y K
+     */
+    constexpr uint8_t obtenerIndiceValor() const {
+        return obtenerRango() < 9 ? obtenerRango() : 9;
+    }
+
+    /**
+     * @brief Obtiene el palo codificado de la carta
+     * @return Palo (0-3)
+     */
+    constexpr uint8_t obtenerIndicePalo() const { return (codigo >> 4) & 0x03; }
+
+    /**
+     * @brief Obtiene el byte que representa la carta
+     * @return Código empaquetado de la carta
+     */
+    constexpr uint8_t obtenerCodigo() const { return codigo; }
+
+    /**
+     * @brief Verifica si la carta tiene un código válido
+     * @return true si la carta es válida, false en caso contrario
+     */
+    constexpr bool esValida() const { return codigo != CODIGO_INVALIDO; }
 
     /**
      * @brief Obtiene el valor de la carta como string
@@ -49,13 +114,16 @@ public:
      * @brief Verifica si la carta es un As
      * @return true si es un As, false en caso contrario
      */
-    bool esAs() const;
+    constexpr bool esAs() const { return obtenerRango() == 0; }
 
     /**
      * @brief Convierte la carta a string para mostrar
      * @return Representación en string de la carta
      */
     string toString() const;
+
+    constexpr bool operator==(const Carta& otra) const { return codigo == otra.codigo; }
+    constexpr bool operator!=(const Carta& otra) const { return codigo != otra.codigo; }
 };
 
-#endif // CARTA_H
\ No newline at end of file
+#endif // CARTA_H
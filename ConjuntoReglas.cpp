@@ -0,0 +1,52 @@
+#include "ConjuntoReglas.h"
+#include <sstream>
+using namespace std;
+
+/**
+ * Notación corta de las mesas: S17/H17, DAS, RS (rendición), el pago y,
+ * solo si falta, la revisión del Blackjack
+ */
+string ConfiguracionReglas::describir() const {
+    stringstream ss;
+    ss << numBarajas << (numBarajas == 1 ? " baraja, " : " barajas, ")
+       << (crupierPideSuave17 ? "H17" : "S17")
+       << (doblarTrasDividir ? ", DAS" : ", sin DAS")
+       << ", " << manosPermitidas() << (manosPermitidas() == 1 ? " mano" : " manos")
+       << (rendicionTardia ? ", RS" : "");
+    switch (pagoBlackjack) {
+        case PagoBlackjack::TRES_A_DOS: ss << ", 3:2"; break;
+        case PagoBlackjack::SEIS_A_CINCO: ss << ", 6:5"; break;
+        case PagoBlackjack::UNO_A_UNO: ss << ", 1:1"; break;
+    }
+    if (!crupierRevisaBlackjack) {
+        ss << ", sin revisión";
+    }
+    return ss.str();
+}
+
+/**
+ * Tabla del conjunto despachado; vive mientras dure el programa
+ */
+const array<bool, EstadoMano::NUM_ESTADOS>& ConfiguracionReglas::tablaCrupier() const {
+    const array<bool, EstadoMano::NUM_ESTADOS>* tabla = nullptr;
+    despachar([&](auto conjunto) { tabla = &decltype(conjunto)::PIDE_CRUPIER; });
+    return *tabla;
+}
+
+/**
+ * Numerador del pago del conjunto despachado
+ */
+int64_t ConfiguracionReglas::numeradorBlackjack() const {
+    int64_t numerador = 0;
+    despachar([&](auto conjunto) { numerador = decltype(conjunto)::PAGO_BLACKJACK_NUMERADOR; });
+    return numerador;
+}
+
+/**
+ * Denominador del pago del conjunto despachado
+ */
+int64_t ConfiguracionReglas::denominadorBlackjack() const {
+    int64_t denominador = 1;
+    despachar([&](auto conjunto) { denominador = decltype(conjunto)::PAGO_BLACKJACK_DENOMINADOR; });
+    return denominador;
+}
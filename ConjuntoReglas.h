@@ -0,0 +1,207 @@
+#ifndef CONJUNTO_REGLAS_H
+#define CONJUNTO_REGLAS_H
+
+#include "Dinero.h"
+#include "EstadoMano.h"
+#include "Mano.h"
+#include "Reglas.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+using namespace std;
+
+/**
+ * @enum PagoBlackjack
+ * @brief Proporción con la que se paga el Blackjack del jugador
+ */
+enum class PagoBlackjack : uint8_t {
+    TRES_A_DOS,   ///< 3:2, la regla clásica
+    SEIS_A_CINCO, ///< 6:5
+    UNO_A_UNO     ///< Pago simple
+};
+
+/**
+ * @struct ConfiguracionReglas
+ * @brief Variante de reglas de una mesa, elegida en tiempo de ejecución
+ *
+ * Las reglas que cambian la forma de jugar cada mano (H17, doblar tras
+ * dividir, rendición y pago del Blackjack) se convierten con despachar()
+ * en un ConjuntoReglas fijado en tiempo de compilación. El número de
+ * barajas, el límite de manos y la revisión del Blackjack quedan como
+ * valores: dimensionan el zapato, acotan la división, que es poco
+ * frecuente, y deciden una vez por ronda si se juega contra un Blackjack.
+ */
+struct ConfiguracionReglas {
+    static constexpr int MAX_MANOS = 4;  ///< Manos por asiento que admite cualquier mesa
+
+    bool crupierPideSuave17 = false;     ///< El crupier pide con 17 suave (H17)
+    bool doblarTrasDividir = true;       ///< Se puede doblar una mano dividida (DAS)
+    bool rendicionTardia = false;        ///< Rendición tras comprobar el Blackjack del crupier
+    PagoBlackjack pagoBlackjack = PagoBlackjack::TRES_A_DOS;  ///< Pago del Blackjack
+    int maxManos = MAX_MANOS;            ///< Manos por asiento tras dividir y redividir (1 = no se divide)
+    int numBarajas = 6;                  ///< Barajas del zapato
+    bool crupierRevisaBlackjack = true;  ///< El crupier mira su carta oculta antes de los turnos (peek)
+
+    /**
+     * @brief Obtiene el límite de manos por asiento dentro del rango admitido
+     * @return maxManos acotado a 1..MAX_MANOS
+     */
+    int manosPermitidas() const { return maxManos < 1 ? 1 : (maxManos > MAX_MANOS ? MAX_MANOS : maxManos); }
+
+    /**
+     * @brief Describe la variante en la notación habitual de las mesas
+     * @return Por ejemplo "6 barajas, S17, DAS, 4 manos, 3:2" (", sin revisión" si no hay peek)
+     */
+    string describir() const;
+
+    /**
+     * @brief Obtiene la decisión del crupier por estado de mano
+     * @return Tabla PIDE_CRUPIER del ConjuntoReglas de la variante
+     */
+    const array<bool, EstadoMano::NUM_ESTADOS>& tablaCrupier() const;
+
+    /**
+     * @brief Obtiene el numerador del pago del Blackjack
+     * @return 3 con 3:2, 6 con 6:5 y 1 con 1:1
+     */
+    int64_t numeradorBlackjack() const;
+
+    /**
+     * @brief Obtiene el denominador del pago del Blackjack
+     * @return 2 con 3:2, 5 con 6:5 y 1 con 1:1
+     */
+    int64_t denominadorBlackjack() const;
+
+    /**
+     * @brief Llama a una función con el ConjuntoReglas de esta variante
+     * @param funcion Función genérica que recibe un objeto ConjuntoReglas<...> vacío
+     *
+     * La función se instancia una vez por variante, de modo que todo lo que
+     * consulta del conjunto son constantes; la elección se hace una sola vez.
+     */
+    template <class Funcion>
+    void despachar(Funcion&& funcion) const;
+};
+
+/**
+ * @class ConjuntoReglas
+ * @brief Reglas de una variante fijadas en tiempo de compilación
+ * @tparam PIDE_SUAVE_17 El crupier pide con 17 suave
+ * @tparam DOBLAR_TRAS_DIVIDIR Se puede doblar una mano dividida
+ * @tparam RENDICION_TARDIA Se puede rendir la mano inicial
+ * @tparam PAGO Pago del Blackjack
+ *
+ * Misma interfaz que Reglas, pero cada consulta es una constante o una
+ * tabla propia de la variante: el motor de rondas instanciado con un
+ * conjunto no evalúa ninguna regla en tiempo de ejecución.
+ */
+template <bool PIDE_SUAVE_17, bool DOBLAR_TRAS_DIVIDIR, bool RENDICION_TARDIA, PagoBlackjack PAGO>
+class ConjuntoReglas {
+public:
+    static constexpr bool CRUPIER_PIDE_SUAVE_17 = PIDE_SUAVE_17;
+    static constexpr bool DOBLA_TRAS_DIVIDIR = DOBLAR_TRAS_DIVIDIR;
+    static constexpr bool RENDICION = RENDICION_TARDIA;
+    static constexpr PagoBlackjack PAGO_BLACKJACK = PAGO;
+    static constexpr int64_t PAGO_BLACKJACK_NUMERADOR =
+        PAGO == PagoBlackjack::TRES_A_DOS ? 3 : (PAGO == PagoBlackjack::SEIS_A_CINCO ? 6 : 1);
+    static constexpr int64_t PAGO_BLACKJACK_DENOMINADOR =
+        PAGO == PagoBlackjack::TRES_A_DOS ? 2 : (PAGO == PagoBlackjack::SEIS_A_CINCO ? 5 : 1);
+    static constexpr array<bool, EstadoMano::NUM_ESTADOS> PIDE_CRUPIER =
+        EstadoMano::construirTablaCrupier(Reglas::PLANTARSE_CRUPIER, PIDE_SUAVE_17);  ///< Decisión del crupier por estado
+
+    /**
+     * @brief Decide si el crupier debe pedir otra carta
+     * @param manoCrupier Mano actual del crupier
+     * @return true si pide en el estado de la mano
+     */
+    static bool crupierDebePedir(const Mano& manoCrupier) { return PIDE_CRUPIER[manoCrupier.obtenerEstado()]; }
+
+    /**
+     * @brief Verifica si una mano puede doblarse
+     * @param manoDividida true si la mano viene de dividir
+     * @return true si las reglas permiten doblarla (con dos cartas)
+     */
+    static constexpr bool puedeDoblar(bool manoDividida) { return DOBLAR_TRAS_DIVIDIR || !manoDividida; }
+
+    /**
+     * @brief Verifica si una mano puede rendirse
+     * @param numCartas Cartas de la mano
+     * @param manoDividida true si la mano viene de dividir
+     * @return true solo con rendición tardía y la mano inicial de dos cartas
+     */
+    static constexpr bool puedeRendirse(int numCartas, bool manoDividida) {
+        return RENDICION_TARDIA && numCartas == 2 && !manoDividida;
+    }
+
+    /**
+     * @brief Calcula el pago por Blackjack, redondeado hacia abajo al centavo
+     * @param apuesta Apuesta original en centavos
+     * @return Cantidad a pagar por Blackjack, sin la apuesta
+     * @pre 0 <= apuesta <= Dinero::APUESTA_MAXIMA
+     */
+    static constexpr Centavos calcularPagoBlackjack(Centavos apuesta) {
+        return apuesta * PAGO_BLACKJACK_NUMERADOR / PAGO_BLACKJACK_DENOMINADOR;
+    }
+
+    /**
+     * @brief Calcula cuánto recibe el jugador al liquidar su apuesta
+     * @param resultado Resultado de Reglas::compararManos()
+     * @param esBlackjack true si la mano del jugador es Blackjack (y no viene de dividir)
+     * @param apuesta Apuesta en centavos
+     * @return Cantidad devuelta al jugador, incluida la apuesta si corresponde
+     * @pre 0 <= apuesta <= Dinero::APUESTA_MAXIMA
+     */
+    static constexpr Centavos calcularRetorno(int resultado, bool esBlackjack, Centavos apuesta) {
+        Centavos ganancia = esBlackjack ? calcularPagoBlackjack(apuesta) : apuesta;
+        return (resultado >= 0) * apuesta + (resultado > 0) * ganancia;
+    }
+
+    /**
+     * @brief Calcula cuánto recibe el jugador al rendirse
+     * @param apuesta Apuesta en centavos
+     * @return Media apuesta; el centavo impar queda para la casa
+     */
+    static constexpr Centavos calcularRetornoRendicion(Centavos apuesta) { return apuesta / 2; }
+};
+
+/// Reglas de Reglas como conjunto: S17, doblar tras dividir, sin rendición, 3:2
+using ReglasEstandar = ConjuntoReglas<false, true, false, PagoBlackjack::TRES_A_DOS>;
+
+/**
+ * Un nivel de despacho por regla: cada bool se convierte en true_type o
+ * false_type y el pago en su integral_constant
+ */
+template <class Funcion>
+void ConfiguracionReglas::despachar(Funcion&& funcion) const {
+    auto conBool = [](bool valor, auto&& siguiente) {
+        if (valor) {
+            siguiente(true_type{});
+        } else {
+            siguiente(false_type{});
+        }
+    };
+    conBool(crupierPideSuave17, [&](auto pideSuave17) {
+        conBool(doblarTrasDividir, [&](auto doblarDividida) {
+            conBool(rendicionTardia, [&](auto rendicion) {
+                auto llamar = [&](auto pago) {
+                    funcion(ConjuntoReglas<decltype(pideSuave17)::value, decltype(doblarDividida)::value,
+                                           decltype(rendicion)::value, decltype(pago)::value>{});
+                };
+                switch (pagoBlackjack) {
+                    case PagoBlackjack::TRES_A_DOS:
+                        llamar(integral_constant<PagoBlackjack, PagoBlackjack::TRES_A_DOS>{});
+                        break;
+                    case PagoBlackjack::SEIS_A_CINCO:
+                        llamar(integral_constant<PagoBlackjack, PagoBlackjack::SEIS_A_CINCO>{});
+                        break;
+                    case PagoBlackjack::UNO_A_UNO:
+                        llamar(integral_constant<PagoBlackjack, PagoBlackjack::UNO_A_UNO>{});
+                        break;
+                }
+            });
+        });
+    });
+}
+
+#endif // CONJUNTO_REGLAS_H
@@ -0,0 +1,33 @@
+#include "Conteo.h"
+using namespace std;
+
+/**
+ * KO empieza en 4 - 4 × barajas para que su punto clave no dependa del zapato
+ */
+int32_t Conteo::cuentaInicial(SistemaConteo sistema, int numBarajas) {
+    return sistema == SistemaConteo::KO ? 4 - 4 * numBarajas : 0;
+}
+
+/**
+ * Cuentas iniciales de todos los sistemas
+ */
+Conteo::Cuentas Conteo::cuentasIniciales(int numBarajas) {
+    Cuentas cuentas{};
+    for (int sistema = 0; sistema < NUM_SISTEMAS; sistema++) {
+        cuentas[sistema] = cuentaInicial(static_cast<SistemaConteo>(sistema), numBarajas);
+    }
+    return cuentas;
+}
+
+/**
+ * Nombre de cada sistema
+ */
+string Conteo::nombre(SistemaConteo sistema) {
+    switch (sistema) {
+        case SistemaConteo::HI_LO: return "Hi-Lo";
+        case SistemaConteo::KO: return "KO";
+        case SistemaConteo::HI_OPT_II: return "Hi-Opt II";
+        case SistemaConteo::OMEGA_II: return "Omega II";
+    }
+    return "Desconocido";
+}
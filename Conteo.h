@@ -0,0 +1,101 @@
+#ifndef CONTEO_H
+#define CONTEO_H
+
+#include "Carta.h"
+#include <array>
+#include <cstdint>
+#include <string>
+using namespace std;
+
+/**
+ * @enum SistemaConteo
+ * @brief Sistemas de conteo de cartas que sigue el zapato
+ */
+enum class SistemaConteo : uint8_t {
+    HI_LO,       ///< Balanceado, nivel 1
+    KO,          ///< Knock-Out: no balanceado, nivel 1 (el 7 suma)
+    HI_OPT_II,   ///< Balanceado, nivel 2, As neutro
+    OMEGA_II     ///< Balanceado, nivel 2, As neutro y 9 negativo
+};
+
+/**
+ * @class Conteo
+ * @brief Etiquetas de cada sistema de conteo y sus cuentas iniciales
+ *
+ * La tabla está indexada por el índice de valor de la carta y tiene una
+ * columna por sistema. Para que repartir una carta actualice todos los
+ * sistemas con una sola suma, cada fila se empaqueta además en un entero
+ * de 64 bits con un carril de 16 bits por sistema; a cada etiqueta se le
+ * suma DESPLAZAMIENTO para que ningún carril sea negativo ni acarree al
+ * siguiente, y ese desplazamiento se descuenta al leer la cuenta.
+ */
+class Conteo {
+public:
+    static constexpr int NUM_SISTEMAS = 4;
+    static constexpr int DESPLAZAMIENTO = 2;      ///< Suma a cada etiqueta para que ningún carril sea negativo
+    static constexpr int BITS_POR_CARRIL = 16;    ///< 416 cartas × 4 caben en 16 bits
+
+    using Cuentas = array<int32_t, NUM_SISTEMAS>;  ///< Una cuenta por sistema
+
+    /// Etiqueta de cada índice de valor (A, 2-9, 10) en Hi-Lo, KO, Hi-Opt II y Omega II
+    static constexpr Cuentas ETIQUETAS[Carta::NUM_VALORES] = {
+        {-1, -1,  0,  0},   // A
+        { 1,  1,  1,  1},   // 2
+        { 1,  1,  1,  1},   // 3
+        { 1,  1,  2,  2},   // 4
+        { 1,  1,  2,  2},   // 5
+        { 1,  1,  1,  2},   // 6
+        { 0,  1,  1,  1},   // 7
+        { 0,  0,  0,  0},   // 8
+        { 0,  0,  0, -1},   // 9
+        {-1, -1, -2, -2}    // 10, J, Q, K
+    };
+
+    /// Filas de ETIQUETAS más DESPLAZAMIENTO, un carril de 16 bits por sistema
+    static constexpr array<uint64_t, Carta::NUM_VALORES> ETIQUETAS_EMPAQUETADAS = [] {
+        array<uint64_t, Carta::NUM_VALORES> filas{};
+        for (int valor = 0; valor < Carta::NUM_VALORES; valor++) {
+            for (int sistema = 0; sistema < NUM_SISTEMAS; sistema++) {
+                filas[valor] |= static_cast<uint64_t>(ETIQUETAS[valor][sistema] + DESPLAZAMIENTO)
+                                << (BITS_POR_CARRIL * sistema);
+            }
+        }
+        return filas;
+    }();
+
+    /**
+     * @brief Desempaqueta la cuenta de un sistema
+     * @param empaquetadas Suma de filas de ETIQUETAS_EMPAQUETADAS
+     * @param numCartas Número de filas sumadas
+     * @param sistema Sistema de conteo
+     * @return Suma de las etiquetas del sistema, sin la cuenta inicial
+     */
+    static constexpr int32_t desempaquetar(uint64_t empaquetadas, int numCartas, SistemaConteo sistema) {
+        uint64_t carril = (empaquetadas >> (BITS_POR_CARRIL * static_cast<int>(sistema))) & 0xFFFF;
+        return static_cast<int32_t>(carril) - DESPLAZAMIENTO * numCartas;
+    }
+
+    /**
+     * @brief Obtiene la cuenta con la que empieza un zapato nuevo
+     * @param sistema Sistema de conteo
+     * @param numBarajas Barajas del zapato
+     * @return 0 en los sistemas balanceados; 4 - 4 × barajas en KO
+     */
+    static int32_t cuentaInicial(SistemaConteo sistema, int numBarajas);
+
+    /**
+     * @brief Obtiene las cuentas iniciales de todos los sistemas
+     * @param numBarajas Barajas del zapato
+     * @return Una cuenta inicial por sistema
+     */
+    static Cuentas cuentasIniciales(int numBarajas);
+
+    /**
+     * @brief Obtiene el nombre de un sistema
+     * @param sistema Sistema de conteo
+     * @return Nombre para mostrar
+     */
+    static string nombre(SistemaConteo sistema);
+};
+
+#endif // CONTEO_H
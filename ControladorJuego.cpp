@@ -7,48 +7,119 @@ using namespace std;
 /**
  * Constructor que inicializa el controlador del juego
  */
-ControladorJuego::ControladorJuego() 
-    : crupier(make_unique<Crupier>()), estadoActual(EstadoJuego::INICIAL), 
-      rondaActual(0), juegoTerminado(false) {}
+ControladorJuego::ControladorJuego(int numBarajas, double penetracion, ModoSalida modoSalida, int numAsientos,
+                                   ostream& destino)
+    : salida(SalidaJuego::crear(modoSalida, destino)),
+      presentador(make_unique<Presentador>(ModoRitmo::SOLO_ANIMACION, chrono::milliseconds(1000), *salida)),
+      crupier(make_unique<Crupier>(numBarajas, penetracion)), asientos(numAsientos),
+      estadoActual(EstadoJuego::INICIAL),
+      rondaActual(0), juegoTerminado(false) {
+    reglas.rendicionTardia = true;
+    // El mazo acota el número de barajas: las reglas describen el zapato real
+    reglas.numBarajas = crupier->obtenerMazo().obtenerNumBarajas();
+    crupier->establecerReglas(reglas);
+    liquidacion.establecerReglas(reglas);
+    crupier->establecerSalida(salida.get());
+    // Sin salida no hay nada que espaciar, y nadie vaciaría el presentador
+    if (modoSalida != ModoSalida::NULA) {
+        crupier->establecerPresentador(presentador.get());
+    }
+}
+
+/**
+ * Cambia el ritmo de la presentación
+ */
+void ControladorJuego::establecerRitmo(ModoRitmo modo, chrono::milliseconds retardo) {
+    presentador->configurar(modo, retardo);
+}
+
+/**
+ * Cambia la variante entre rondas: el crupier toma su tabla y la
+ * liquidación su pago. El zapato ya está hecho, así que otro número de
+ * barajas se rechaza, igual que jugar sin revisar el Blackjack
+ */
+bool ControladorJuego::establecerReglas(const ConfiguracionReglas& nuevas) {
+    if (!rondaTerminada() || nuevas.numBarajas != crupier->obtenerMazo().obtenerNumBarajas() ||
+        !nuevas.crupierRevisaBlackjack) {
+        return false;
+    }
+    reglas = nuevas;
+    crupier->establecerReglas(reglas);
+    liquidacion.establecerReglas(reglas);
+    if (historial) {
+        historial->registrarReglas(reglas);
+    }
+    return true;
+}
+
+/**
+ * Sienta un jugador en el primer asiento libre, solo entre rondas: la ronda
+ * suspendida recorre los asientos y una posición nueva los reubicaría
+ */
+int ControladorJuego::agregarJugador(const string& nombre, Centavos dineroInicial) {
+    if (!rondaTerminada()) {
+        return -1;
+    }
+    return asientos.sentar(nombre, dineroInicial);
+}
+
+/**
+ * Agrega un jugador que apuesta a la mano de otro asiento, solo entre rondas
+ */
+int ControladorJuego::agregarApuestaDetras(int asiento, const string& nombre, Centavos dineroInicial) {
+    if (!rondaTerminada()) {
+        return -1;
+    }
+    return asientos.agregarDetras(asiento, nombre, dineroInicial);
+}
 
 /**
- * Agrega un jugador al juego
+ * Libera el asiento solo entre rondas, cuando nadie tiene apuesta en juego
  */
-void ControladorJuego::agregarJugador(const string& nombre, double dineroInicial) {
-    jugadores.push_back(make_unique<JugadorHumano>(nombre, dineroInicial));
+bool ControladorJuego::levantarJugador(int asiento) {
+    return rondaTerminada() && asientos.levantar(asiento);
+}
+
+/**
+ * Getter de los asientos
+ */
+const Asientos& ControladorJuego::obtenerAsientos() const {
+    return asientos;
 }
 
 /**
  * Inicia el juego principal
  */
 void ControladorJuego::iniciarJuego() {
-    cout << "\n========================================" << endl;
-    cout << "       BIENVENIDO AL BLACKJACK" << endl;
-    cout << "========================================" << endl;
+    *salida << "\n========================================\n";
+    *salida << "       BIENVENIDO AL BLACKJACK\n";
+    *salida << "========================================\n";
 
     // Si no hay jugadores, permitir agregar múltiples
-    if (jugadores.empty()) {
+    if (asientos.numPosiciones() == 0) {
         int numJugadores;
-        cout << "¿Cuántos jugadores van a jugar? (1-4): ";
+        *salida << "¿Cuántos jugadores van a jugar? (1-" << asientos.numAsientos() << "): ";
+        salida->flush();
         cin >> numJugadores;
         cin.ignore();
         
         // Validar número de jugadores
-        if (numJugadores < 1 || numJugadores > 4) {
+        if (numJugadores < 1 || numJugadores > asientos.numAsientos()) {
             numJugadores = 1;
-            cout << "Número inválido. Se establecerá 1 jugador." << endl;
+            *salida << "Número inválido. Se establecerá 1 jugador.\n";
         }
         
         // Agregar cada jugador
         for (int i = 1; i <= numJugadores; i++) {
             string nombre;
-            cout << "Ingresa el nombre del jugador " << i << ": ";
+            *salida << "Ingresa el nombre del jugador " << i << ": ";
+            salida->flush();
             getline(cin, nombre);
             if (nombre.empty()) {
                 nombre = "Jugador" + to_string(i);
             }
             agregarJugador(nombre);
-            cout << "Jugador agregado: " << nombre << " con $1000" << endl;
+            *salida << "Jugador agregado: " << nombre << " con $1000\n";
         }
     }
 
@@ -61,7 +132,8 @@ void ControladorJuego::iniciarJuego() {
         // Preguntar si quiere continuar
         if (puedenContinuar()) {
             char respuesta;
-            cout << "\n¿Quieres jugar otra ronda? (s/n): ";
+            *salida << "\n¿Quieres jugar otra ronda? (s/n): ";
+            salida->flush();
             cin >> respuesta;
             cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
@@ -72,55 +144,176 @@ void ControladorJuego::iniciarJuego() {
     }
 
     mostrarEstadisticas();
-    cout << "\n¡Gracias por jugar!" << endl;
+    *salida << "\n¡Gracias por jugar!\n";
+    salida->flush();
+}
+
+/**
+ * Abre el historial, reinicia el zapato desde su semilla y registra la sesión
+ */
+bool ControladorJuego::activarHistorial(const string& ruta) {
+    auto nuevo = make_unique<EscritorHistorial>();
+    if (!nuevo->abrir(ruta)) {
+        return false;
+    }
+    historial = move(nuevo);
+    crupier->sembrar(crupier->obtenerSemilla());
+    const Mazo& zapato = crupier->obtenerMazo();
+    historial->registrarInicioSesion(zapato.obtenerSemilla(), zapato.obtenerNumBarajas(),
+                                     zapato.obtenerPosicionCorte());
+    historial->registrarReglas(reglas);
+    crupier->establecerHistorial(historial.get());
+    return true;
 }
 
 /**
- * Procesa una ronda completa del juego
+ * Ciclo de consola: lee una línea por cada entrada que pide la ronda
  */
 void ControladorJuego::procesarRonda() {
+    comenzarRonda();
+    string linea;
+    while (!rondaTerminada()) {
+        if (solicitudPendiente().tipo == TipoSolicitud::PRESENTACION) {
+            presentador->drenar();
+            entregarEntrada("");
+            continue;
+        }
+        salida->flush();
+        if (!getline(cin, linea)) {
+            linea = "0";  // Fin de la entrada: no apostar y plantarse
+        }
+        entregarEntrada(linea);
+    }
+}
+
+/**
+ * Crea la corrutina de la ronda y la deja correr hasta su primera espera
+ */
+void ControladorJuego::comenzarRonda() {
+    ronda = jugarRonda();
+    ronda.reanudar();
+}
+
+/**
+ * Reanuda la ronda con la respuesta del jugador
+ */
+bool ControladorJuego::entregarEntrada(const string& linea) {
+    return entrada.entregar(linea);
+}
+
+/**
+ * Getter de la solicitud pendiente
+ */
+const SolicitudEntrada& ControladorJuego::solicitudPendiente() const {
+    return entrada.pendiente();
+}
+
+/**
+ * Verifica si la ronda terminó
+ */
+bool ControladorJuego::rondaTerminada() const {
+    return ronda.terminada();
+}
+
+/**
+ * Getter del presentador
+ */
+Presentador& ControladorJuego::obtenerPresentador() {
+    return *presentador;
+}
+
+/**
+ * Corrutina de una ronda completa
+ */
+Tarea ControladorJuego::jugarRonda() {
     rondaActual++;
-    cout << "\n========================================" << endl;
-    cout << "             RONDA " << rondaActual << endl;
-    cout << "========================================" << endl;
+    if (historial) {
+        historial->registrarInicioRonda(static_cast<uint32_t>(rondaActual));
+    }
+    *salida << "\n========================================\n";
+    *salida << "             RONDA " << rondaActual << '\n';
+    *salida << "========================================\n";
 
     // Limpiar manos de la ronda anterior
     limpiarManos();
 
+    // Barajar solo entre rondas, cuando ya salió la carta de corte
+    if (crupier->barajarSiAlcanzoCorte()) {
+        *salida << "Se alcanzó la carta de corte. Barajando el zapato...\n";
+    }
+
     // Secuencia de estados del juego
     estadoActual = EstadoJuego::APOSTANDO;
-    manejarEstadoApostando();
+    co_await manejarEstadoApostando();
 
     estadoActual = EstadoJuego::REPARTIENDO;
     manejarEstadoRepartiendo();
 
+    if (crupier->obtenerMano().obtenerCartas()[0].esAs()) {
+        co_await ofrecerSeguro();
+    }
+
+    // El crupier mira su carta oculta: con Blackjack nadie juega su mano
     estadoActual = EstadoJuego::TURNO_JUGADOR;
-    manejarTurnoJugadores();
+    if (crupier->obtenerMano().esBlackjack()) {
+        *salida << "\n¡El crupier tiene Blackjack!\n";
+    } else {
+        co_await manejarTurnoJugadores();
+    }
 
     estadoActual = EstadoJuego::TURNO_CRUPIER;
     manejarTurnoCrupier();
+    if (presentador->lineasPendientes() > 0) {
+        // El turno del crupier quedó programado; la ronda sigue cuando se haya mostrado
+        co_await entrada.esperar(TipoSolicitud::PRESENTACION, -1);
+    }
 
     estadoActual = EstadoJuego::DETERMINANDO_GANADOR;
     determinarGanadores();
 
     estadoActual = EstadoJuego::FINALIZADO;
+    if (historial) {
+        historial->vaciar();
+    }
 }
 
 /**
  * Maneja el estado de apuestas
  */
-void ControladorJuego::manejarEstadoApostando() {
-    cout << "\n--- FASE DE APUESTAS ---" << endl;
+Tarea ControladorJuego::manejarEstadoApostando() {
+    *salida << "\n--- FASE DE APUESTAS ---\n";
+
+    // Los titulares entraron antes que quienes apuestan detrás de ellos
+    const vector<Centavos>& dineros = asientos.obtenerDineros();
+    for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+        int asiento = asientos.obtenerAsiento(posicion);
+        bool titular = asientos.esTitular(posicion);
+        if (dineros[posicion] <= 0 ||
+            (!titular && asientos.obtenerApuesta(asientos.obtenerTitular(asiento)) <= 0)) {
+            continue;
+        }
 
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerDinero() > 0) {
-            double apuesta = jugador->solicitarApuesta();
-            if (apuesta > 0) {
-                jugador->apostar(apuesta);
-                cout << jugador->obtenerNombre() << " apuesta $" << apuesta << endl;
-            } else {
-                cout << jugador->obtenerNombre() << " no apuesta esta ronda." << endl;
+        Centavos apuesta = 0;
+        *salida << "\n" << asientos.obtenerInfo(posicion) << '\n';
+        if (!titular) {
+            *salida << "Apuesta detrás del asiento " << asiento + 1 << ".\n";
+        }
+        *salida << "¿Cuánto quieres apostar? (0 para no apostar): $";
+        string linea;
+        do {
+            linea = co_await entrada.esperar(TipoSolicitud::APUESTA, posicion);
+        } while (!JugadorHumano::interpretarApuesta(linea, dineros[posicion], *salida, apuesta));
+
+        if (apuesta > 0) {
+            asientos.apostar(posicion, apuesta);
+            // El historial identifica la posición por su asiento y su orden en él
+            if (historial) {
+                historial->registrarApuesta(static_cast<uint8_t>(asiento), apuesta,
+                                            static_cast<uint8_t>(asientos.ordenEnAsiento(posicion)));
             }
+            *salida << asientos.obtenerNombre(posicion) << " apuesta $" << Dinero::formatear(apuesta) << '\n';
+        } else {
+            *salida << asientos.obtenerNombre(posicion) << " no apuesta esta ronda.\n";
         }
     }
 }
@@ -129,12 +322,15 @@ void ControladorJuego::manejarEstadoApostando() {
  * Maneja el estado de reparto de cartas iniciales
  */
 void ControladorJuego::manejarEstadoRepartiendo() {
-    cout << "\n--- REPARTIENDO CARTAS INICIALES ---" << endl;
-
-    // Repartir cartas iniciales a todos los jugadores
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerApuestaActual() > 0) {
-            crupier->repartirCartasIniciales(jugador.get());
+    *salida << "\n--- REPARTIENDO CARTAS INICIALES ---\n";
+
+    // Repartir cartas iniciales a todos los asientos con apuesta
+    const vector<EstadoAsiento>& estados = asientos.obtenerEstados();
+    for (int asiento = 0; asiento < asientos.numAsientos(); asiento++) {
+        if (estados[asiento] == EstadoAsiento::JUGANDO) {
+            for (int i = 0; i < 2; i++) {
+                asientos.recibirCarta(asiento, crupier->repartirCarta(static_cast<uint8_t>(asiento)));
+            }
         }
     }
 
@@ -142,19 +338,50 @@ void ControladorJuego::manejarEstadoRepartiendo() {
     crupier->repartirCartasIniciales(crupier.get());
 
     // Mostrar cartas iniciales
-    cout << "\nCartas iniciales:" << endl;
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerApuestaActual() > 0) {
-            jugador->mostrarMano();
+    *salida << "\nCartas iniciales:\n";
+    for (int asiento = 0; asiento < asientos.numAsientos(); asiento++) {
+        if (estados[asiento] != EstadoAsiento::VACIO && estados[asiento] != EstadoAsiento::SIN_APUESTA) {
+            *salida << "\n" << asientos.obtenerNombre(asientos.obtenerTitular(asiento)) << " - "
+                    << asientos.obtenerMano(asiento).toString() << '\n';
         }
     }
 
     crupier->mostrarManoParcial();
 
     // Verificar Blackjacks
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerApuestaActual() > 0 && jugador->obtenerMano().esBlackjack()) {
-            cout << "\n¡" << jugador->obtenerNombre() << " tiene Blackjack!" << endl;
+    for (int asiento = 0; asiento < asientos.numAsientos(); asiento++) {
+        if (estados[asiento] == EstadoAsiento::BLACKJACK) {
+            *salida << "\n¡" << asientos.obtenerNombre(asientos.obtenerTitular(asiento)) << " tiene Blackjack!\n";
+        }
+    }
+}
+
+/**
+ * Cada posición con apuesta decide si se asegura; con Blackjack propio el
+ * seguro equivale al pago par
+ */
+Tarea ControladorJuego::ofrecerSeguro() {
+    *salida << "\n--- SEGURO ---\n";
+
+    for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+        Centavos seguro = asientos.obtenerApuesta(posicion) / 2;
+        if (seguro <= 0 || seguro > asientos.obtenerDinero(posicion)) {
+            continue;
+        }
+
+        int asiento = asientos.obtenerAsiento(posicion);
+        *salida << "\n" << asientos.obtenerNombre(posicion) << ", el crupier muestra un As. ";
+        if (asientos.obtenerEstado(asiento) == EstadoAsiento::BLACKJACK) {
+            *salida << "¿Quieres pago par? ";
+        }
+        *salida << "¿Tomas seguro por $" << Dinero::formatear(seguro) << "? (s/n): ";
+        string linea = co_await entrada.esperar(TipoSolicitud::SEGURO, posicion);
+        if (JugadorHumano::interpretarRespuesta(linea) && asientos.asegurar(posicion)) {
+            if (historial) {
+                historial->registrarSeguro(static_cast<uint8_t>(asiento), seguro,
+                                           static_cast<uint8_t>(asientos.ordenEnAsiento(posicion)));
+            }
+            *salida << asientos.obtenerNombre(posicion) << " toma seguro.\n";
         }
     }
 }
@@ -162,45 +389,166 @@ void ControladorJuego::manejarEstadoRepartiendo() {
 /**
  * Maneja el turno de los jugadores
  */
-void ControladorJuego::manejarTurnoJugadores() {
-    cout << "\n--- TURNO DE LOS JUGADORES ---" << endl;
+Tarea ControladorJuego::manejarTurnoJugadores() {
+    *salida << "\n--- TURNO DE LOS JUGADORES ---\n";
 
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerApuestaActual() > 0 && !jugador->obtenerMano().esBlackjack()) {
-            procesarTurnoJugador(jugador.get());
+    const vector<EstadoAsiento>& estados = asientos.obtenerEstados();
+    for (int asiento = 0; asiento < asientos.numAsientos(); asiento++) {
+        if (estados[asiento] == EstadoAsiento::JUGANDO) {
+            co_await procesarTurnoJugador(asiento);
         }
     }
 }
 
 /**
- * Procesa el turno de un jugador individual
+ * Procesa el turno de un jugador individual; las manos divididas se agregan
+ * al final del asiento y se juegan en orden
  */
-void ControladorJuego::procesarTurnoJugador(JugadorHumano* jugador) {
-    cout << "\nTurno de " << jugador->obtenerNombre() << ":" << endl;
+Tarea ControladorJuego::procesarTurnoJugador(int asiento) {
+    // Copia: el turno se suspende y no debe apuntar dentro de los asientos
+    const string nombre = asientos.obtenerNombre(asientos.obtenerTitular(asiento));
+    uint8_t asientoHistorial = static_cast<uint8_t>(asiento);
+    *salida << "\nTurno de " << nombre << ":\n";
+
+    for (int mano = 0; mano < asientos.numManos(asiento); mano++) {
+        if (asientos.numManos(asiento) > 1) {
+            *salida << "\nMano " << mano + 1 << ":\n";
+        }
+
+        for (;;) {
+            // Una mano dividida recibe su segunda carta; con Ases, solo esa
+            const Mano& cartas = asientos.obtenerMano(asiento, mano);
+            if (cartas.obtenerNumeroCartas() == 1) {
+                repartirAMano(asiento, mano);
+                if (cartas.obtenerCartas()[0].esAs()) {
+                    asientos.plantar(asiento, mano);
+                }
+            }
+
+            if (!preguntarOtraCarta(asiento, mano)) {
+                break;
+            }
+            string linea = co_await entrada.esperar(TipoSolicitud::DECISION, asiento);
+            Accion accion = JugadorHumano::interpretarDecision(linea);
+            // Los asientos tienen la última palabra sobre lo que mueve dinero
+            bool aplicada = accionPermitida(asiento, mano, accion);
+            if (aplicada && accion == Accion::DIVIDIR) {
+                aplicada = asientos.dividir(asiento, mano);
+            } else if (aplicada && accion == Accion::DOBLAR) {
+                aplicada = asientos.doblar(asiento, mano);
+            } else if (aplicada && accion == Accion::RENDIRSE) {
+                aplicada = asientos.rendirse(asiento);
+            }
+            if (!aplicada) {
+                *salida << "Esa opción no está disponible.\n";
+                continue;
+            }
+            if (historial) {
+                historial->registrarDecision(asientoHistorial, accion);
+            }
+
+            if (accion == Accion::PLANTARSE) {
+                asientos.plantar(asiento, mano);
+                break;
+            }
+            if (accion == Accion::RENDIRSE) {
+                break;
+            }
+            if (accion == Accion::DIVIDIR) {
+                *salida << nombre << " divide la pareja.\n";
+            } else if (accion == Accion::DOBLAR) {
+                *salida << nombre << " dobla la apuesta.\n";
+                repartirAMano(asiento, mano);
+                asientos.plantar(asiento, mano);
+            } else {
+                repartirAMano(asiento, mano);
+            }
+        }
 
-    while (jugador->quiereOtraCarta() && !jugador->obtenerMano().sePaso()) {
-        auto carta = crupier->repartirCarta();
-        if (carta != nullptr) {
-            jugador->recibirCarta(carta);
-            cout << "Recibes: " << carta->toString() << endl;
+        switch (asientos.obtenerEstado(asiento, mano)) {
+            case EstadoAsiento::PASADO:
+                *salida << "¡" << nombre << " se pasó de 21!\n";
+                break;
+            case EstadoAsiento::RENDIDO:
+                *salida << nombre << " se rinde y recupera media apuesta.\n";
+                break;
+            default:
+                *salida << nombre << " se planta con " << asientos.obtenerTotal(asiento, mano) << '\n';
         }
     }
+}
 
-    if (jugador->obtenerMano().sePaso()) {
-        cout << "¡" << jugador->obtenerNombre() << " se pasó de 21!" << endl;
-    } else {
-        cout << jugador->obtenerNombre() << " se planta con " << jugador->obtenerMano().calcularValor() << endl;
+/**
+ * Reparte una carta a la mano y la anuncia
+ */
+void ControladorJuego::repartirAMano(int asiento, int mano) {
+    Carta carta = crupier->repartirCarta(static_cast<uint8_t>(asiento));
+    if (carta.esValida()) {
+        asientos.recibirCarta(asiento, carta, mano);
+        *salida << "Recibes: " << carta.toString() << '\n';
     }
 }
 
+/**
+ * Doblar y dividir cuestan otra apuesta de la mano; la rendición solo vale
+ * para la mano inicial sin dividir
+ */
+bool ControladorJuego::accionPermitida(int asiento, int mano, Accion accion) const {
+    const Mano& cartas = asientos.obtenerMano(asiento, mano);
+    bool dosCartas = cartas.obtenerNumeroCartas() == 2;
+    bool dividida = asientos.numManos(asiento) > 1;
+    Centavos apuesta = asientos.obtenerApuestaMano(asiento, mano);
+    bool cubre = apuesta <= asientos.obtenerDinero(asientos.obtenerTitular(asiento));
+    switch (accion) {
+        case Accion::DOBLAR:
+            return dosCartas && cubre && apuesta <= Dinero::APUESTA_MAXIMA - apuesta &&
+                   (!dividida || reglas.doblarTrasDividir);
+        case Accion::DIVIDIR:
+            return dosCartas && cubre && cartas.esPar() && asientos.numManos(asiento) < reglas.manosPermitidas();
+        case Accion::RENDIRSE:
+            return dosCartas && !dividida && reglas.rendicionTardia;
+        default:
+            return true;
+    }
+}
+
+/**
+ * Muestra la mano y la pregunta; si ya terminó no hay nada que preguntar
+ */
+bool ControladorJuego::preguntarOtraCarta(int asiento, int mano) const {
+    *salida << "\n" << asientos.obtenerNombre(asientos.obtenerTitular(asiento)) << ", tu mano actual:\n";
+    *salida << asientos.obtenerMano(asiento, mano).toString() << '\n';
+
+    EstadoAsiento estado = asientos.obtenerEstado(asiento, mano);
+    if (estado == EstadoAsiento::PASADO) {
+        *salida << "¡Te pasaste de 21!\n";
+    }
+    if (estado != EstadoAsiento::JUGANDO) {
+        return false;
+    }
+    *salida << "¿Quieres otra carta? (s/n";
+    if (accionPermitida(asiento, mano, Accion::DOBLAR)) {
+        *salida << ", d = doblar";
+    }
+    if (accionPermitida(asiento, mano, Accion::DIVIDIR)) {
+        *salida << ", v = dividir";
+    }
+    if (accionPermitida(asiento, mano, Accion::RENDIRSE)) {
+        *salida << ", r = rendirse";
+    }
+    *salida << "): ";
+    return true;
+}
+
 /**
  * Maneja el turno del crupier
  */
 void ControladorJuego::manejarTurnoCrupier() {
-    // Solo jugar si hay jugadores que no se hayan pasado
+    // Solo jugar si hay manos que no se hayan pasado ni rendido
     bool hayJugadoresEnJuego = false;
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerApuestaActual() > 0 && !jugador->obtenerMano().sePaso()) {
+    for (EstadoAsiento estado : asientos.obtenerEstados()) {
+        if (estado == EstadoAsiento::PLANTADO || estado == EstadoAsiento::BLACKJACK ||
+            estado == EstadoAsiento::JUGANDO) {
             hayJugadoresEnJuego = true;
             break;
         }
@@ -209,72 +557,150 @@ void ControladorJuego::manejarTurnoCrupier() {
     if (hayJugadoresEnJuego) {
         crupier->jugarTurno();
     } else {
-        cout << "\nTodos los jugadores se pasaron. El crupier no necesita jugar." << endl;
+        *salida << "\nNinguna mano sigue en juego. El crupier no necesita jugar.\n";
         crupier->mostrarManoCompleta();
     }
 }
 
 /**
  * Determina los ganadores y paga las apuestas
+ * La liquidación recorre los arreglos de la mesa por lotes; el texto se
+ * escribe después, en mostrarLiquidacion
  */
 void ControladorJuego::determinarGanadores() {
-    cout << "\n--- DETERMINANDO GANADORES ---" << endl;
-
-    for (auto& jugador : jugadores) {
-        if (jugador->obtenerApuestaActual() > 0) {
-            int resultado = crupier->determinarGanador(jugador.get());
-            double apuesta = jugador->obtenerApuestaActual();
-
-            cout << "\n" << jugador->obtenerNombre() << ": ";
-
-            if (resultado == 1) {
-                // Jugador gana
-                if (jugador->obtenerMano().esBlackjack()) {
-                    double pago = calcularPagoBlackjack(apuesta);
-                    jugador->ganar(apuesta + pago);
-                    cout << "¡BLACKJACK! Ganas $" << pago << " (apuesta devuelta)";
-                } else {
-                    jugador->ganar(apuesta * 2);
-                    cout << "¡GANAS! Recibes $" << apuesta;
-                }
-            } else if (resultado == 0) {
-                // Empate
-                jugador->ganar(apuesta);
-                cout << "EMPATE. Apuesta devuelta.";
-            } else {
+    const Mano& manoCrupier = crupier->obtenerMano();
+    bool liquidados = liquidacion.liquidar(asientos, manoCrupier);
+
+    // La liquidación no paga los retornos que desbordarían y pagarTodos deja
+    // sin cobrar los saldos que desbordarían; se apartan antes de pagar para
+    // avisar y no registrarlos como cobrados
+    const vector<Centavos>& retornos = liquidacion.obtenerRetornos();
+    const vector<uint8_t>& desbordados = liquidacion.obtenerDesbordados();
+    const vector<Centavos>& dineros = asientos.obtenerDineros();
+    vector<uint8_t> rechazados(retornos.size(), 0);
+    for (size_t posicion = 0; posicion < retornos.size(); posicion++) {
+        Centavos saldo;
+        rechazados[posicion] = desbordados[posicion] || !Dinero::sumar(dineros[posicion], retornos[posicion], saldo);
+    }
+    bool pagados = asientos.pagarTodos(retornos) && liquidados;
+
+    // El historial liquida al titular una vez por mano y a quien apuesta
+    // detrás por la primera mano del asiento, sin el seguro, que tiene su
+    // propio evento
+    if (historial) {
+        const vector<int8_t>& resultados = liquidacion.obtenerResultadosMano();
+        int totalCrupier = manoCrupier.calcularValor();
+        for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+            Centavos apuesta = asientos.obtenerApuesta(posicion);
+            if (apuesta <= 0 || rechazados[posicion]) {
+                continue;
+            }
+            int asiento = asientos.obtenerAsiento(posicion);
+            int manos = asientos.esTitular(posicion) ? asientos.numManos(asiento) : 1;
+            uint8_t apostador = static_cast<uint8_t>(asientos.ordenEnAsiento(posicion));
+            for (int mano = 0; mano < manos; mano++) {
+                int8_t resultado = resultados[asientos.indiceMano(asiento, mano)];
+                Centavos apuestaMano = apostador == 0 ? asientos.obtenerApuestaMano(asiento, mano) : apuesta;
+                Centavos retorno = Liquidacion::retornoDe(resultado, apuestaMano,
+                                                          reglas.numeradorBlackjack(), reglas.denominadorBlackjack());
+                historial->registrarLiquidacion(static_cast<uint8_t>(asiento), min<int>(resultado, Liquidacion::GANA),
+                                                asientos.obtenerTotal(asiento, mano), totalCrupier, retorno, apostador);
+            }
+        }
+    }
+
+    mostrarLiquidacion();
+    if (!pagados) {
+        for (size_t posicion = 0; posicion < rechazados.size(); posicion++) {
+            if (desbordados[posicion]) {
+                *salida << "\n¡No se pudo pagar a " << asientos.obtenerNombre(static_cast<int>(posicion))
+                        << ": el pago supera el máximo! El pago queda sin cobrar.";
+            } else if (rechazados[posicion]) {
+                *salida << "\n¡No se pudo pagar $" << Dinero::formatear(retornos[posicion]) << " a "
+                        << asientos.obtenerNombre(static_cast<int>(posicion))
+                        << ": el saldo superaría el máximo! El pago queda sin cobrar.";
+            }
+        }
+    }
+}
+
+/**
+ * Muestra el resultado de cada apuesta: la primera mano, las divididas del
+ * titular y el seguro
+ */
+void ControladorJuego::mostrarLiquidacion() const {
+    *salida << "\n--- DETERMINANDO GANADORES ---\n";
+
+    auto mostrarResultado = [this](int8_t resultado, Centavos apuesta) {
+        switch (resultado) {
+            case Liquidacion::GANA_BLACKJACK:
+                *salida << "¡BLACKJACK! Ganas $" << Dinero::formatear(calcularPagoBlackjack(apuesta)) << " (apuesta devuelta)";
+                break;
+            case Liquidacion::GANA:
+                *salida << "¡GANAS! Recibes $" << Dinero::formatear(apuesta);
+                break;
+            case Liquidacion::EMPATE:
+                *salida << "EMPATE. Apuesta devuelta.";
+                break;
+            case Liquidacion::RINDE:
+                *salida << "TE RINDES. Recuperas $" << Dinero::formatear(apuesta / 2);
+                break;
+            default:
                 // Jugador pierde (apuesta ya fue descontada)
-                cout << "PIERDES. Apuesta perdida.";
+                *salida << "PIERDES. Apuesta perdida.";
+        }
+    };
+
+    const vector<int8_t>& resultados = liquidacion.obtenerResultados();
+    const vector<int8_t>& resultadosMano = liquidacion.obtenerResultadosMano();
+    bool blackjackCrupier = crupier->obtenerMano().esBlackjack();
+    for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+        Centavos apuesta = asientos.obtenerApuesta(posicion);
+        if (apuesta <= 0) continue;
+
+        int asiento = asientos.obtenerAsiento(posicion);
+        int manos = asientos.esTitular(posicion) ? asientos.numManos(asiento) : 1;
+        *salida << "\n" << asientos.obtenerNombre(posicion) << ": ";
+        mostrarResultado(resultados[posicion], apuesta);
+        for (int mano = 1; mano < manos; mano++) {
+            *salida << "\n  Mano " << mano + 1 << ": ";
+            mostrarResultado(resultadosMano[asientos.indiceMano(asiento, mano)], asientos.obtenerApuestaMano(asiento, mano));
+        }
+
+        Centavos seguro = asientos.obtenerSeguro(posicion);
+        if (seguro > 0) {
+            *salida << "\n  Seguro: ";
+            if (blackjackCrupier) {
+                *salida << "se paga 2:1, ganas $" << Dinero::formatear(seguro * 2);
+            } else {
+                *salida << "perdido.";
             }
         }
     }
 }
 
 /**
- * Calcula el pago por Blackjack (3:2)
+ * Calcula el pago por Blackjack con la proporción de la mesa: la misma
+ * fórmula que liquida, sin la apuesta devuelta
  */
-double ControladorJuego::calcularPagoBlackjack(double apuesta) const {
-    return apuesta * 1.5;  // 3:2 = 1.5
+Centavos ControladorJuego::calcularPagoBlackjack(Centavos apuesta) const {
+    return Liquidacion::retornoDe(Liquidacion::GANA_BLACKJACK, apuesta, reglas.numeradorBlackjack(),
+                                  reglas.denominadorBlackjack()) - apuesta;
 }
 
 /**
  * Verifica si los jugadores pueden continuar
  */
 bool ControladorJuego::puedenContinuar() const {
-    for (const auto& jugador : jugadores) {
-        if (jugador->obtenerDinero() > 0) {
-            return true;
-        }
-    }
-    return false;
+    const vector<Centavos>& dineros = asientos.obtenerDineros();
+    return any_of(dineros.begin(), dineros.end(), [](Centavos dinero) { return dinero > 0; });
 }
 
 /**
  * Limpia las manos para una nueva ronda
  */
 void ControladorJuego::limpiarManos() {
-    for (auto& jugador : jugadores) {
-        jugador->reiniciarMano();
-    }
+    asientos.reiniciarRonda();
     crupier->reiniciarMano();
 }
 
@@ -282,15 +708,15 @@ void ControladorJuego::limpiarManos() {
  * Muestra las estadísticas finales
  */
 void ControladorJuego::mostrarEstadisticas() const {
-    cout << "\n========================================" << endl;
-    cout << "           ESTADÍSTICAS FINALES" << endl;
-    cout << "========================================" << endl;
-    cout << "Rondas jugadas: " << rondaActual << endl;
-    cout << "Cartas restantes en el mazo: " << crupier->obtenerCartasRestantes() << endl;
-
-    cout << "\nEstado final de los jugadores:" << endl;
-    for (const auto& jugador : jugadores) {
-        cout << "- " << jugador->obtenerInfo() << endl;
+    *salida << "\n========================================\n";
+    *salida << "           ESTADÍSTICAS FINALES\n";
+    *salida << "========================================\n";
+    *salida << "Rondas jugadas: " << rondaActual << '\n';
+    *salida << "Cartas restantes en el mazo: " << crupier->obtenerCartasRestantes() << '\n';
+
+    *salida << "\nEstado final de los jugadores:\n";
+    for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+        *salida << "- " << asientos.obtenerInfo(posicion) << '\n';
     }
 }
 
@@ -312,11 +738,11 @@ EstadoJuego ControladorJuego::obtenerEstadoActual() const {
  * Muestra el menú principal
  */
 void ControladorJuego::mostrarMenuPrincipal() const {
-    cout << "\n========================================" << endl;
-    cout << "              MENÚ PRINCIPAL" << endl;
-    cout << "========================================" << endl;
-    cout << "1. Jugar nueva ronda" << endl;
-    cout << "2. Ver estadísticas" << endl;
-    cout << "3. Salir" << endl;
-    cout << "========================================" << endl;
+    *salida << "\n========================================\n";
+    *salida << "              MENÚ PRINCIPAL\n";
+    *salida << "========================================\n";
+    *salida << "1. Jugar nueva ronda\n";
+    *salida << "2. Ver estadísticas\n";
+    *salida << "3. Salir\n";
+    *salida << "========================================\n";
 }
\ No newline at end of file
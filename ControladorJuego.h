@@ -1,8 +1,12 @@
 #ifndef CONTROLADOR_JUEGO_H
 #define CONTROLADOR_JUEGO_H
 
+#include "Asientos.h"
+#include "ConjuntoReglas.h"
 #include "Crupier.h"
 #include "JugadorHumano.h"
+#include "Liquidacion.h"
+#include "Corrutinas.h"
 #include <vector>
 #include <memory>
 using namespace std;
@@ -28,20 +32,48 @@ enum class EstadoJuego {
  * Esta clase implementa el patrón Controller y State para manejar
  * el flujo del juego, las interacciones entre jugadores y crupier,
  * y la aplicación de las reglas del Blackjack.
+ *
+ * La ronda es una corrutina: las fases que necesitan una respuesta del
+ * jugador se suspenden en un CanalEntrada en lugar de leer de cin. Quien
+ * aloja la mesa arranca la ronda con comenzarRonda(), consulta
+ * solicitudPendiente() y entrega cada respuesta con entregarEntrada(); el
+ * controlador no crea hilos. procesarRonda() es ese mismo ciclo leyendo de
+ * la consola.
+ *
+ * Si el crupier muestra un As se ofrece el seguro, y antes de los turnos el
+ * crupier mira si tiene Blackjack. Cada asiento juega sus manos en orden:
+ * puede pedir, plantarse, doblar, dividir hasta el límite de manos y, con
+ * rendición tardía, rendirse. La regla del crupier (S17 o H17), el pago del
+ * Blackjack y las opciones del jugador salen de la ConfiguracionReglas de
+ * la mesa.
  */
 class ControladorJuego {
 private:
+    unique_ptr<SalidaJuego> salida;                 ///< Destino de todo el texto del juego
+    unique_ptr<Presentador> presentador;            ///< Ritmo de la salida en consola
     unique_ptr<Crupier> crupier;                    ///< Crupier del juego
-    vector<unique_ptr<JugadorHumano>> jugadores;    ///< Lista de jugadores
+    unique_ptr<EscritorHistorial> historial;        ///< Historial binario (nullptr si está desactivado)
+    Asientos asientos;                              ///< Titulares, apuestas detrás y manos
+    Liquidacion liquidacion;                        ///< Resultados y retornos de la última ronda
+    ConfiguracionReglas reglas;                     ///< Variante de la mesa (S17, DAS, rendición, 4 manos y 3:2 por defecto)
     EstadoJuego estadoActual;                       ///< Estado actual del juego
     int rondaActual;                                ///< Número de ronda actual
     bool juegoTerminado;                            ///< Flag para terminar el juego
+    CanalEntrada entrada;                           ///< Donde la ronda espera a los jugadores
+    Tarea ronda;                                    ///< Ronda en curso (se destruye primero)
+
+    /**
+     * @brief Corrutina de una ronda completa, de las apuestas a los pagos
+     * @return Tarea que se suspende cada vez que espera a un jugador
+     */
+    Tarea jugarRonda();
 
     /**
      * @brief Maneja el estado de apuestas
+     * @return Tarea que se suspende hasta recibir cada apuesta
      * @post Los jugadores realizan sus apuestas
      */
-    void manejarEstadoApostando();
+    Tarea manejarEstadoApostando();
 
     /**
      * @brief Maneja el estado de reparto de cartas
@@ -49,11 +81,19 @@ private:
      */
     void manejarEstadoRepartiendo();
 
+    /**
+     * @brief Ofrece el seguro a cada posición con apuesta
+     * @return Tarea que se suspende hasta recibir cada respuesta (s/n)
+     * @pre La carta visible del crupier es un As
+     */
+    Tarea ofrecerSeguro();
+
     /**
      * @brief Maneja el turno de los jugadores
+     * @return Tarea que se suspende hasta recibir cada decisión
      * @post Los jugadores toman sus decisiones
      */
-    void manejarTurnoJugadores();
+    Tarea manejarTurnoJugadores();
 
     /**
      * @brief Maneja el turno del crupier
@@ -63,10 +103,17 @@ private:
 
     /**
      * @brief Determina los ganadores y paga las apuestas
-     * @post Se determinan los resultados y se pagan las apuestas
+     * @post Se determinan los resultados y se pagan las apuestas; un pago
+     *       que desbordaría el saldo se anuncia y no se registra en el historial
      */
     void determinarGanadores();
 
+    /**
+     * @brief Muestra el resultado de cada apuesta de la última liquidación
+     * @post Imprime una línea por posición con apuesta
+     */
+    void mostrarLiquidacion() const;
+
     /**
      * @brief Verifica si algún jugador tiene dinero para continuar
      * @return true si al menos un jugador puede continuar, false en caso contrario
@@ -86,25 +133,58 @@ private:
     void mostrarEstadoJuego() const;
 
     /**
-     * @brief Procesa el turno de un jugador individual
-     * @param jugador Puntero al jugador
-     * @post El jugador toma cartas hasta plantarse o pasarse
+     * @brief Procesa el turno del titular de un asiento
+     * @param asiento Asiento del jugador
+     * @return Tarea que se suspende hasta recibir cada decisión
+     * @post Cada mano del asiento terminó: plantada, pasada, doblada o rendida
+     */
+    Tarea procesarTurnoJugador(int asiento);
+
+    /**
+     * @brief Reparte una carta a una mano y la muestra
+     * @param asiento Asiento del jugador
+     * @param mano Índice de la mano dentro del asiento
+     */
+    void repartirAMano(int asiento, int mano);
+
+    /**
+     * @brief Verifica si una acción está disponible para una mano
+     * @param asiento Asiento del jugador
+     * @param mano Índice de la mano dentro del asiento
+     * @param accion Acción elegida
+     * @return true si las reglas y el dinero del titular la permiten
      */
-    void procesarTurnoJugador(JugadorHumano* jugador);
+    bool accionPermitida(int asiento, int mano, Accion accion) const;
 
     /**
-     * @brief Calcula el pago por Blackjack (3:2)
-     * @param apuesta Apuesta original
-     * @return Cantidad a pagar por Blackjack
+     * @brief Muestra una mano y pregunta qué hacer, con las opciones disponibles
+     * @param asiento Asiento del jugador
+     * @param mano Índice de la mano dentro del asiento
+     * @return false si la mano ya terminó y no hace falta preguntar
      */
-    double calcularPagoBlackjack(double apuesta) const;
+    bool preguntarOtraCarta(int asiento, int mano) const;
+
+    /**
+     * @brief Calcula el pago por Blackjack con la proporción de la mesa
+     * @param apuesta Apuesta original, en centavos
+     * @return Cantidad a pagar por Blackjack, redondeada hacia abajo al centavo
+     */
+    Centavos calcularPagoBlackjack(Centavos apuesta) const;
 
 public:
     /**
      * @brief Constructor de la clase ControladorJuego
+     * @param numBarajas Número de barajas del zapato
+     * @param penetracion Fracción del zapato que se reparte antes de barajar
+     * @param modoSalida Modo de la salida de texto (NULA para simulaciones y pruebas)
+     * @param numAsientos Número de asientos de la mesa (1 a Asientos::MAX_ASIENTOS)
+     * @param destino Flujo donde termina el texto del juego
+     * @pre destino debe vivir más que el controlador
      * @post Inicializa el juego con un crupier
      */
-    ControladorJuego();
+    ControladorJuego(int numBarajas = 1, double penetracion = 0.75,
+                     ModoSalida modoSalida = ModoSalida::INTERACTIVA, int numAsientos = 7,
+                     ostream& destino = cout);
 
     /**
      * @brief Destructor de la clase ControladorJuego
@@ -112,12 +192,50 @@ public:
     ~ControladorJuego() = default;
 
     /**
-     * @brief Agrega un jugador al juego
+     * @brief Sienta un jugador en el primer asiento libre
      * @param nombre Nombre del jugador
-     * @param dineroInicial Dinero inicial del jugador
+     * @param dineroInicial Dinero inicial del jugador, en centavos
+     * @return Posición del jugador, o -1 si la mesa está llena o hay una
+     *         ronda en curso
      * @post Se agrega un nuevo jugador al juego
      */
-    void agregarJugador(const string& nombre, double dineroInicial = 1000.0);
+    int agregarJugador(const string& nombre, Centavos dineroInicial = Dinero::desdeDolares(1000));
+
+    /**
+     * @brief Agrega un jugador que apuesta detrás de un asiento
+     * @param asiento Asiento a cuya mano apuesta
+     * @param nombre Nombre del jugador
+     * @param dineroInicial Dinero inicial del jugador, en centavos
+     * @return Posición del jugador, o -1 si el asiento está vacío o hay una
+     *         ronda en curso
+     * @post Solo apuesta en las rondas en que apuesta el titular, y no decide
+     */
+    int agregarApuestaDetras(int asiento, const string& nombre, Centavos dineroInicial = Dinero::desdeDolares(1000));
+
+    /**
+     * @brief Libera un asiento entre rondas
+     * @param asiento Asiento a liberar
+     * @return false si hay una ronda en curso o el asiento está vacío
+     * @post Se van el titular y quienes apuestan detrás; las demás
+     *       posiciones pueden cambiar de índice, los asientos no
+     */
+    bool levantarJugador(int asiento);
+
+    /**
+     * @brief Cambia la variante de reglas de la mesa
+     * @param nuevas Reglas; numBarajas debe coincidir con el zapato de la mesa
+     * @return false si hay una ronda en curso, el número de barajas es otro
+     *         o el crupier no revisa el Blackjack (la mesa siempre lo revisa)
+     * @post El crupier, los pagos y las opciones del jugador siguen las
+     *       nuevas reglas desde la próxima ronda, y el historial las registra
+     */
+    bool establecerReglas(const ConfiguracionReglas& nuevas);
+
+    /**
+     * @brief Obtiene el estado de los asientos
+     * @return Asientos de la mesa
+     */
+    const Asientos& obtenerAsientos() const;
 
     /**
      * @brief Inicia el juego principal
@@ -144,11 +262,63 @@ public:
     bool haTerminado() const;
 
     /**
-     * @brief Procesa una ronda completa del juego
+     * @brief Configura el ritmo con que se muestra el juego
+     * @param modo Modo de ritmo (sin retardo, fijo o solo animaciones)
+     * @param retardo Retardo entre líneas
+     * @post Por defecto se usa SOLO_ANIMACION con 1000 ms
+     */
+    void establecerRitmo(ModoRitmo modo, chrono::milliseconds retardo);
+
+    /**
+     * @brief Activa el historial binario de la sesión
+     * @param ruta Archivo donde se agregan los eventos
+     * @return true si el archivo se abrió, false en caso contrario
+     * @post El zapato se vuelve a barajar desde su semilla y se registra el
+     *       inicio de sesión, para que la sesión pueda reproducirse
+     */
+    bool activarHistorial(const string& ruta);
+
+    /**
+     * @brief Procesa una ronda completa del juego leyendo de la consola
      * @post Ejecuta una ronda desde apuestas hasta determinar ganadores
      */
     void procesarRonda();
 
+    /**
+     * @brief Arranca una ronda sin bloquear
+     * @pre No hay otra ronda en curso
+     * @post La ronda corre hasta la primera entrada que necesita. Tras el
+     *       turno del crupier espera PRESENTACION si el presentador tiene
+     *       líneas pendientes; quien aloja la mesa las emite y entrega ""
+     */
+    void comenzarRonda();
+
+    /**
+     * @brief Entrega la respuesta que espera la ronda suspendida
+     * @param linea Respuesta del jugador (cantidad, s/n, o d, v, r)
+     * @return false si la ronda no esperaba entrada
+     * @post La ronda continúa hasta la siguiente entrada o hasta terminar
+     */
+    bool entregarEntrada(const string& linea);
+
+    /**
+     * @brief Obtiene la entrada que espera la ronda
+     * @return Solicitud pendiente (tipo NINGUNA si la ronda no espera)
+     */
+    const SolicitudEntrada& solicitudPendiente() const;
+
+    /**
+     * @brief Verifica si la ronda en curso terminó
+     * @return true si no hay ronda en curso
+     */
+    bool rondaTerminada() const;
+
+    /**
+     * @brief Obtiene el presentador que marca el ritmo de la salida
+     * @return Presentador del controlador
+     */
+    Presentador& obtenerPresentador();
+
     /**
      * @brief Obtiene el estado actual del juego
      * @return Estado actual del juego
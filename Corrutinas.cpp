@@ -0,0 +1,91 @@
+#include "Corrutinas.h"
+#include <exception>
+#include <utility>
+using namespace std;
+
+/**
+ * El proyecto no usa excepciones: una que escape de una fase es un error fatal
+ */
+void Tarea::promise_type::unhandled_exception() const noexcept {
+    terminate();
+}
+
+/**
+ * Constructor usado por get_return_object
+ */
+Tarea::Tarea(coroutine_handle<promise_type> corrutina) : corrutina(corrutina) {}
+
+/**
+ * Constructor de una tarea vacía
+ */
+Tarea::Tarea() : corrutina(nullptr) {}
+
+/**
+ * Destructor que libera el marco de la corrutina
+ */
+Tarea::~Tarea() {
+    if (corrutina) {
+        corrutina.destroy();
+    }
+}
+
+/**
+ * Constructor de movimiento
+ */
+Tarea::Tarea(Tarea&& otra) noexcept : corrutina(exchange(otra.corrutina, nullptr)) {}
+
+/**
+ * Asignación de movimiento
+ */
+Tarea& Tarea::operator=(Tarea&& otra) noexcept {
+    if (this != &otra) {
+        if (corrutina) {
+            corrutina.destroy();
+        }
+        corrutina = exchange(otra.corrutina, nullptr);
+    }
+    return *this;
+}
+
+/**
+ * Reanuda la corrutina de nivel superior
+ */
+void Tarea::reanudar() {
+    if (!terminada()) {
+        corrutina.resume();
+    }
+}
+
+/**
+ * Verifica si la tarea terminó
+ */
+bool Tarea::terminada() const {
+    return !corrutina || corrutina.done();
+}
+
+/**
+ * Prepara la espera de una línea
+ */
+CanalEntrada::Espera CanalEntrada::esperar(TipoSolicitud tipo, int asiento) {
+    return Espera{*this, SolicitudEntrada{tipo, asiento}};
+}
+
+/**
+ * Guarda la línea y reanuda la corrutina suspendida
+ */
+bool CanalEntrada::entregar(const string& linea) {
+    if (!esperando) {
+        return false;
+    }
+    valor = linea;
+    solicitud = SolicitudEntrada();
+    exchange(esperando, nullptr).resume();
+    return true;
+}
+
+/**
+ * Getter de la solicitud pendiente
+ */
+const SolicitudEntrada& CanalEntrada::pendiente() const {
+    return solicitud;
+}
@@ -0,0 +1,161 @@
+#ifndef CORRUTINAS_H
+#define CORRUTINAS_H
+
+#include <coroutine>
+#include <string>
+using namespace std;
+
+/**
+ * @class Tarea
+ * @brief Corrutina sin valor de retorno que se puede esperar con co_await
+ *
+ * La tarea se crea suspendida. Una tarea de nivel superior se arranca con
+ * reanudar(); una tarea esperada con co_await desde otra corrutina arranca
+ * en ese momento y, al terminar, devuelve el control a quien la esperaba.
+ * No usa hilos: cada fase corre en el hilo que la reanuda.
+ */
+class Tarea {
+public:
+    /**
+     * @brief Estado de la corrutina exigido por el compilador
+     */
+    struct promise_type {
+        coroutine_handle<> continuacion = noop_coroutine();  ///< Quien espera esta tarea
+
+        /**
+         * @brief Al terminar, salta a la corrutina que esperaba esta tarea
+         */
+        struct EsperaFinal {
+            bool await_ready() const noexcept { return false; }
+            coroutine_handle<> await_suspend(coroutine_handle<promise_type> tarea) noexcept {
+                return tarea.promise().continuacion;
+            }
+            void await_resume() const noexcept {}
+        };
+
+        Tarea get_return_object() { return Tarea(coroutine_handle<promise_type>::from_promise(*this)); }
+        suspend_always initial_suspend() const noexcept { return {}; }
+        EsperaFinal final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept;
+    };
+
+private:
+    coroutine_handle<promise_type> corrutina;  ///< Marco de la corrutina (nulo si está vacía)
+
+    explicit Tarea(coroutine_handle<promise_type> corrutina);
+
+public:
+    /**
+     * @brief Constructor de una tarea vacía (ya terminada)
+     */
+    Tarea();
+
+    /**
+     * @brief Destructor; destruye el marco de la corrutina y el de sus subtareas
+     */
+    ~Tarea();
+
+    Tarea(Tarea&& otra) noexcept;
+    Tarea& operator=(Tarea&& otra) noexcept;
+    Tarea(const Tarea&) = delete;
+    Tarea& operator=(const Tarea&) = delete;
+
+    /**
+     * @brief Arranca o continúa una tarea de nivel superior
+     * @pre La tarea no está terminada ni esperada por otra corrutina
+     * @post Corre hasta su próxima suspensión o hasta terminar
+     */
+    void reanudar();
+
+    /**
+     * @brief Verifica si la tarea terminó
+     * @return true si la tarea terminó o está vacía
+     */
+    bool terminada() const;
+
+    // Interfaz de co_await: la tarea arranca y retoma a quien la espera al terminar
+    bool await_ready() const noexcept { return terminada(); }
+    coroutine_handle<> await_suspend(coroutine_handle<> llamador) noexcept {
+        corrutina.promise().continuacion = llamador;
+        return corrutina;
+    }
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @enum TipoSolicitud
+ * @brief Dato que una ronda suspendida espera de un jugador
+ */
+enum class TipoSolicitud {
+    NINGUNA,       ///< La ronda no espera entrada
+    APUESTA,       ///< Cantidad a apostar
+    DECISION,      ///< Decisión sobre una mano
+    SEGURO,        ///< Aceptar el seguro (s/n)
+    PRESENTACION   ///< Hay líneas con ritmo pendientes; se continúa al emitirlas
+};
+
+/**
+ * @struct SolicitudEntrada
+ * @brief Entrada que espera una ronda suspendida
+ */
+struct SolicitudEntrada {
+    TipoSolicitud tipo = TipoSolicitud::NINGUNA;  ///< Qué se espera
+    int asiento = -1;                             ///< Posición que apuesta o se asegura, o asiento que decide
+};
+
+/**
+ * @class CanalEntrada
+ * @brief Punto donde una corrutina se suspende hasta recibir una línea
+ *
+ * La corrutina hace co_await esperar(...) y queda suspendida; quien aloja
+ * la ronda consulta pendiente() y, cuando llega la respuesta, llama a
+ * entregar(), que reanuda la corrutina en su propio hilo. Admite una sola
+ * espera a la vez.
+ */
+class CanalEntrada {
+private:
+    coroutine_handle<> esperando;   ///< Corrutina suspendida (nula si ninguna)
+    SolicitudEntrada solicitud;     ///< Qué espera la corrutina
+    string valor;                   ///< Línea entregada
+
+public:
+    /**
+     * @brief Espera de una línea; co_await retorna la línea entregada
+     */
+    struct Espera {
+        CanalEntrada& canal;
+        SolicitudEntrada solicitud;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<> corrutina) noexcept {
+            canal.esperando = corrutina;
+            canal.solicitud = solicitud;
+        }
+        string await_resume() { return move(canal.valor); }
+    };
+
+    /**
+     * @brief Suspende la corrutina hasta que se entregue una línea
+     * @param tipo Qué dato se espera
+     * @param asiento Asiento que debe responder
+     * @return Objeto para co_await
+     */
+    Espera esperar(TipoSolicitud tipo, int asiento);
+
+    /**
+     * @brief Entrega una línea y reanuda la corrutina que la esperaba
+     * @param linea Respuesta del jugador
+     * @return false si ninguna corrutina esperaba entrada
+     * @post La corrutina corre hasta su próxima suspensión o hasta terminar
+     */
+    bool entregar(const string& linea);
+
+    /**
+     * @brief Obtiene la solicitud pendiente
+     * @return Solicitud pendiente (tipo NINGUNA si no hay)
+     */
+    const SolicitudEntrada& pendiente() const;
+};
+
+#endif // CORRUTINAS_H
@@ -1,78 +1,121 @@
 #include "Crupier.h"
+#include "Reglas.h"
 #include <iostream>
-#include <thread>
-#include <chrono>
 using namespace std;
 
 /**
- * Constructor que inicializa el crupier con un mazo nuevo
+ * Constructor que inicializa el crupier con un zapato nuevo
  */
-Crupier::Crupier() : Jugador("Crupier", 0), mazo(make_unique<Mazo>()) {}
+Crupier::Crupier(int numBarajas, double penetracion)
+    : Jugador("Crupier", 0), mazo(make_unique<Mazo>(numBarajas, penetracion)) {}
 
 /**
  * Implementación polimórfica de la regla del crupier
- * El crupier debe pedir carta si tiene menos de 17
+ * La tabla de la variante decide por estado de mano (S17 o H17)
  */
 bool Crupier::quiereOtraCarta() const {
-    return mano.calcularValor() < 17;
+    return (*pideCrupier)[mano.obtenerEstado()];
+}
+
+/**
+ * Toma la tabla del crupier de la variante
+ */
+void Crupier::establecerReglas(const ConfiguracionReglas& reglas) {
+    pideCrupier = &reglas.tablaCrupier();
 }
 
 /**
  * Reparte una carta del mazo
+ * Con la carta de corte el zapato no se agota en medio de una mano; el
+ * reinicio aquí solo cubre una penetración del 100%
  */
-shared_ptr<Carta> Crupier::repartirCarta() {
+Carta Crupier::repartirCarta(uint8_t asiento) {
     if (mazo->estaVacio()) {
-        cout << "¡El mazo está vacío! Reiniciando..." << endl;
-        mazo->reiniciar();
+        *salida << "¡El mazo está vacío! Reiniciando...\n";
+        barajarZapato();
     }
-    return mazo->repartirCarta();
+    Carta carta = mazo->repartirCarta();
+    if (historial != nullptr) {
+        historial->registrarCarta(asiento, carta);
+    }
+    return carta;
 }
 
 /**
  * Reparte las cartas iniciales a un jugador (2 cartas)
  */
-void Crupier::repartirCartasIniciales(Jugador* jugador) {
+void Crupier::repartirCartasIniciales(Jugador* jugador, uint8_t asiento) {
     if (jugador == nullptr) return;
 
     // Repartir 2 cartas iniciales
     for (int i = 0; i < 2; i++) {
-        auto carta = repartirCarta();
-        if (carta != nullptr) {
+        Carta carta = repartirCarta(asiento);
+        if (carta.esValida()) {
             jugador->recibirCarta(carta);
         }
     }
 }
 
+/**
+ * Asigna el historial del crupier
+ */
+void Crupier::establecerHistorial(EscritorHistorial* historial) {
+    this->historial = historial;
+}
+
+/**
+ * Baraja el zapato y registra el evento
+ */
+void Crupier::barajarZapato() {
+    mazo->reiniciar();
+    if (historial != nullptr) {
+        historial->registrarBarajado();
+    }
+}
+
+/**
+ * Asigna el presentador del crupier
+ */
+void Crupier::establecerPresentador(Presentador* presentador) {
+    this->presentador = presentador;
+}
+
+/**
+ * Programa la línea en el presentador o la escribe directamente
+ */
+void Crupier::mostrar(const string& linea, bool esAnimacion) const {
+    if (presentador != nullptr) {
+        presentador->programar(linea, esAnimacion);
+    } else {
+        *salida << linea << '\n';
+    }
+}
+
 /**
  * Juega el turno del crupier automáticamente
+ * Las pausas se marcan como animación en lugar de bloquear el hilo
  */
 void Crupier::jugarTurno() {
-    cout << "\nTurno del crupier:" << endl;
-    cout << "El crupier revela su mano:" << endl;
-    mostrarManoCompleta();
-
-    // Pausa para dramatismo
-    this_thread::sleep_for(chrono::milliseconds(1000));
+    mostrar("\nTurno del crupier:");
+    mostrar("El crupier revela su mano:");
+    mostrar("Crupier - " + mano.toString(), true);
 
     // Pedir cartas mientras sea necesario
     while (quiereOtraCarta() && !mano.sePaso()) {
-        cout << "\nEl crupier pide una carta..." << endl;
-        auto carta = repartirCarta();
-        if (carta != nullptr) {
+        mostrar("\nEl crupier pide una carta...");
+        Carta carta = repartirCarta();
+        if (carta.esValida()) {
             recibirCarta(carta);
-            cout << "El crupier recibe: " << carta->toString() << endl;
-            cout << "Mano del crupier: " << mano.toString() << endl;
-
-            // Pausa para dramatismo
-            this_thread::sleep_for(chrono::milliseconds(1000));
+            mostrar("El crupier recibe: " + carta.toString());
+            mostrar("Mano del crupier: " + mano.toString(), true);
         }
     }
 
     // Resultado final
     if (mano.sePaso()) {
-        cout << "\n¡El crupier se pasó de 21!" << endl;
+        mostrar("\n¡El crupier se pasó de 21!");
     } else {
-        cout << "\nEl crupier se planta con " << mano.calcularValor() << endl;
+        mostrar("\nEl crupier se planta con " + to_string(mano.calcularValor()));
     }
 }
 
@@ -80,14 +123,14 @@ void Crupier::jugarTurno() {
  * Muestra la mano del crupier parcialmente (carta oculta)
  */
 void Crupier::mostrarManoParcial() const {
-    cout << "Crupier - " << mano.toStringParcial() << endl;
+    *salida << "Crupier - " << mano.toStringParcial() << '\n';
 }
 
 /**
  * Muestra la mano completa del crupier
  */
 void Crupier::mostrarManoCompleta() const {
-    cout << "Crupier - " << mano.toString() << endl;
+    *salida << "Crupier - " << mano.toString() << '\n';
 }
 
 /**
@@ -96,51 +139,46 @@ void Crupier::mostrarManoCompleta() const {
  */
 int Crupier::determinarGanador(const Jugador* jugador) const {
     if (jugador == nullptr) return -1;
+    return Reglas::compararManos(jugador->obtenerMano(), mano);
+}
 
-    const Mano& manoJugador = jugador->obtenerMano();
-    int valorJugador = manoJugador.calcularValor();
-    int valorCrupier = mano.calcularValor();
-
-    // Si el jugador se pasó, pierde
-    if (manoJugador.sePaso()) {
-        return -1;
-    }
-
-    // Si el crupier se pasó y el jugador no, el jugador gana
-    if (mano.sePaso()) {
-        return 1;
-    }
-
-    // Si ambos tienen Blackjack, es empate
-    if (manoJugador.esBlackjack() && mano.esBlackjack()) {
-        return 0;
-    }
+/**
+ * Reinicia el mazo completo
+ */
+void Crupier::reiniciarMazo() {
+    barajarZapato();
+}
 
-    // Si solo el jugador tiene Blackjack, gana
-    if (manoJugador.esBlackjack()) {
-        return 1;
+/**
+ * Baraja el zapato entre rondas si ya salió la carta de corte
+ */
+bool Crupier::barajarSiAlcanzoCorte() {
+    if (!mazo->alcanzoCorte()) {
+        return false;
     }
+    barajarZapato();
+    return true;
+}
 
-    // Si solo el crupier tiene Blackjack, gana
-    if (mano.esBlackjack()) {
-        return -1;
-    }
+/**
+ * Siembra el zapato del crupier
+ */
+void Crupier::sembrar(uint64_t semilla) {
+    mazo->sembrar(semilla);
+}
 
-    // Comparar valores
-    if (valorJugador > valorCrupier) {
-        return 1;  // Jugador gana
-    } else if (valorJugador < valorCrupier) {
-        return -1; // Crupier gana
-    } else {
-        return 0;  // Empate
-    }
+/**
+ * Getter para la semilla del zapato
+ */
+uint64_t Crupier::obtenerSemilla() const {
+    return mazo->obtenerSemilla();
 }
 
 /**
- * Reinicia el mazo completo
+ * Getter para el zapato
  */
-void Crupier::reiniciarMazo() {
-    mazo->reiniciar();
+const Mazo& Crupier::obtenerMazo() const {
+    return *mazo;
 }
 
 /**
@@ -1,8 +1,11 @@
 #ifndef CRUPIER_H
 #define CRUPIER_H
 
+#include "ConjuntoReglas.h"
 #include "Jugador.h"
 #include "Mazo.h"
+#include "Presentador.h"
+#include "HistorialBinario.h"
 #include <memory>
 using namespace std;
 
@@ -17,13 +20,30 @@ using namespace std;
 class Crupier : public Jugador {
 private:
     unique_ptr<Mazo> mazo;  ///< Mazo de cartas que maneja el crupier
+    Presentador* presentador = nullptr;  ///< Capa de presentación (no se posee)
+    EscritorHistorial* historial = nullptr;  ///< Historial de eventos (no se posee)
+    const array<bool, EstadoMano::NUM_ESTADOS>* pideCrupier = &Reglas::PIDE_CRUPIER;  ///< Decisión por estado (S17 por defecto)
+
+    /**
+     * @brief Baraja el zapato y lo anota en el historial
+     */
+    void barajarZapato();
+
+    /**
+     * @brief Envía una línea al presentador o, si no hay, a la consola
+     * @param linea Texto a mostrar
+     * @param esAnimacion true si la línea marca una pausa de animación
+     */
+    void mostrar(const string& linea, bool esAnimacion = false) const;
 
 public:
     /**
      * @brief Constructor de la clase Crupier
-     * @post Crea un crupier con un mazo nuevo
+     * @param numBarajas Número de barajas del zapato
+     * @param penetracion Fracción del zapato que se reparte antes de barajar
+     * @post Crea un crupier con un zapato nuevo
      */
-    Crupier();
+    Crupier(int numBarajas = 1, double penetracion = 0.75);
 
     /**
      * @brief Destructor de la clase Crupier
@@ -32,30 +52,54 @@ public:
 
     /**
      * @brief Implementación polimórfica para decidir si quiere otra carta
-     * @return true si el valor de la mano es menor a 17, false en caso contrario
-     * @post Aplica la regla estándar del crupier (pedir hasta 17)
+     * @return true si las reglas de la mesa piden en el estado de la mano
+     * @post Aplica la regla de la mesa (S17 salvo que se indique H17)
      */
     bool quiereOtraCarta() const override;
 
     /**
      * @brief Reparte una carta del mazo
-     * @return Puntero compartido a la carta repartida
+     * @param asiento Asiento que recibe la carta, para el historial
+     * @return Carta repartida
      * @pre El mazo no debe estar vacío
-     * @post Se remueve una carta del mazo
+     * @post Se remueve una carta del mazo y se registra en el historial
      */
-    shared_ptr<Carta> repartirCarta();
+    Carta repartirCarta(uint8_t asiento = EventoHistorial::ASIENTO_CRUPIER);
 
     /**
      * @brief Reparte las cartas iniciales a un jugador
      * @param jugador Puntero al jugador que recibe las cartas
+     * @param asiento Asiento del jugador, para el historial
      * @pre jugador no debe ser nullptr
      * @post El jugador recibe 2 cartas iniciales
      */
-    void repartirCartasIniciales(Jugador* jugador);
+    void repartirCartasIniciales(Jugador* jugador, uint8_t asiento = EventoHistorial::ASIENTO_CRUPIER);
+
+    /**
+     * @brief Asigna la regla del crupier de una variante
+     * @param reglas Reglas de la mesa; solo se usa crupierPideSuave17
+     */
+    void establecerReglas(const ConfiguracionReglas& reglas);
+
+    /**
+     * @brief Asigna el historial donde se anotan cartas y barajados
+     * @param historial Historial a usar, o nullptr para no registrar
+     */
+    void establecerHistorial(EscritorHistorial* historial);
+
+    /**
+     * @brief Asigna la capa de presentación que controla el ritmo
+     * @param presentador Presentador a usar, o nullptr para escribir directo
+     * @pre El presentador debe vivir más que el crupier o reemplazarse antes
+     */
+    void establecerPresentador(Presentador* presentador);
 
     /**
      * @brief Juega el turno del crupier automáticamente
-     * @post El crupier pide cartas según las reglas hasta alcanzar 17 o más
+     * @post El crupier pide cartas según la regla de la mesa
+     *
+     * El turno termina sin esperas: las pausas de la revelación y de cada
+     * carta se programan en el presentador, que las aplica al mostrarlas.
      */
     void jugarTurno();
 
@@ -85,6 +129,32 @@ public:
      */
     void reiniciarMazo();
 
+    /**
+     * @brief Baraja el zapato si se alcanzó la carta de corte
+     * @return true si se barajó, false en caso contrario
+     * @pre Solo debe llamarse entre rondas
+     */
+    bool barajarSiAlcanzoCorte();
+
+    /**
+     * @brief Siembra el zapato para obtener una sesión reproducible
+     * @param semilla Semilla del generador aleatorio
+     * @post El zapato se baraja de nuevo a partir de la semilla
+     */
+    void sembrar(uint64_t semilla);
+
+    /**
+     * @brief Obtiene la semilla actual del zapato
+     * @return Semilla del generador aleatorio
+     */
+    uint64_t obtenerSemilla() const;
+
+    /**
+     * @brief Obtiene el zapato del crupier
+     * @return Referencia constante al mazo
+     */
+    const Mazo& obtenerMazo() const;
+
     /**
      * @brief Obtiene el número de cartas restantes en el mazo
      * @return Número de cartas que quedan en el mazo
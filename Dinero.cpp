@@ -0,0 +1,110 @@
+#include "Dinero.h"
+#include <cctype>
+using namespace std;
+
+/**
+ * Suma verificada
+ */
+bool Dinero::sumar(Centavos a, Centavos b, Centavos& resultado) {
+    Centavos suma;
+    if (__builtin_add_overflow(a, b, &suma)) {
+        return false;
+    }
+    resultado = suma;
+    return true;
+}
+
+/**
+ * Resta verificada
+ */
+bool Dinero::restar(Centavos a, Centavos b, Centavos& resultado) {
+    Centavos diferencia;
+    if (__builtin_sub_overflow(a, b, &diferencia)) {
+        return false;
+    }
+    resultado = diferencia;
+    return true;
+}
+
+/**
+ * Multiplica y luego divide; la división entera de positivos redondea hacia abajo
+ */
+bool Dinero::aplicarProporcion(Centavos cantidad, int64_t numerador, int64_t denominador, Centavos& resultado) {
+    Centavos producto;
+    if (cantidad < 0 || denominador <= 0 || __builtin_mul_overflow(cantidad, numerador, &producto)) {
+        return false;
+    }
+    resultado = producto / denominador;
+    return true;
+}
+
+/**
+ * Signo opcional, dígitos y hasta dos decimales tras '.' o ','
+ */
+bool Dinero::desdeTexto(const string& texto, Centavos& resultado) {
+    size_t i = 0;
+    size_t fin = texto.size();
+    while (i < fin && isspace(static_cast<unsigned char>(texto[i]))) i++;
+    while (fin > i && isspace(static_cast<unsigned char>(texto[fin - 1]))) fin--;
+
+    bool negativo = false;
+    if (i < fin && (texto[i] == '-' || texto[i] == '+')) {
+        negativo = texto[i] == '-';
+        i++;
+    }
+
+    Centavos unidades = 0;
+    size_t digitos = 0;
+    for (; i < fin && isdigit(static_cast<unsigned char>(texto[i])); i++, digitos++) {
+        if (__builtin_mul_overflow(unidades, 10, &unidades) ||
+            __builtin_add_overflow(unidades, texto[i] - '0', &unidades)) {
+            return false;
+        }
+    }
+
+    Centavos centavos = 0;
+    if (i < fin && (texto[i] == '.' || texto[i] == ',')) {
+        i++;
+        int decimales = 0;
+        for (; i < fin && isdigit(static_cast<unsigned char>(texto[i])); i++, decimales++, digitos++) {
+            if (decimales == 2) {
+                return false;  // Menos de un centavo
+            }
+            centavos = centavos * 10 + (texto[i] - '0');
+        }
+        if (decimales == 1) {
+            centavos *= 10;
+        }
+    }
+    if (i != fin || digitos == 0) {
+        return false;
+    }
+
+    Centavos total;
+    if (__builtin_mul_overflow(unidades, CENTAVOS_POR_UNIDAD, &total) ||
+        __builtin_add_overflow(total, centavos, &total)) {
+        return false;
+    }
+    resultado = negativo ? -total : total;
+    return true;
+}
+
+/**
+ * Conversión a dólares
+ */
+double Dinero::aDolares(Centavos cantidad) {
+    return static_cast<double>(cantidad) / CENTAVOS_POR_UNIDAD;
+}
+
+/**
+ * Formato en dólares; el valor absoluto se toma sin signo para admitir INT64_MIN
+ */
+string Dinero::formatear(Centavos cantidad) {
+    uint64_t absoluto = cantidad < 0 ? 0 - static_cast<uint64_t>(cantidad) : static_cast<uint64_t>(cantidad);
+    uint64_t centavos = absoluto % CENTAVOS_POR_UNIDAD;
+    string texto = (cantidad < 0 ? "-" : "") + to_string(absoluto / CENTAVOS_POR_UNIDAD);
+    if (centavos != 0) {
+        texto += (centavos < 10 ? ".0" : ".") + to_string(centavos);
+    }
+    return texto;
+}
@@ -0,0 +1,88 @@
+#ifndef DINERO_H
+#define DINERO_H
+
+#include <cstdint>
+#include <string>
+using namespace std;
+
+/**
+ * @brief Cantidad de dinero en centavos
+ *
+ * Todo el dinero del juego (saldos, apuestas, pagos y totales) se guarda
+ * como un entero de centavos, de modo que las sumas son exactas y no
+ * dependen del orden en que se acumulan.
+ */
+using Centavos = int64_t;
+
+/**
+ * @class Dinero
+ * @brief Aritmética de dinero en centavos, con verificación de desbordamiento
+ *
+ * Las operaciones que pueden desbordar retornan false y no modifican el
+ * resultado. Los pagos proporcionales (3:2, 6:5) se redondean hacia abajo
+ * al centavo: la fracción de centavo queda para la casa, como en mesa.
+ */
+class Dinero {
+public:
+    static constexpr Centavos CENTAVOS_POR_UNIDAD = 100;                  ///< Centavos en un dólar
+    static constexpr Centavos APUESTA_MAXIMA = INT64_MAX / 8;             ///< Los pagos de cualquier apuesta caben en 64 bits
+
+    /**
+     * @brief Suma dos cantidades
+     * @param a Primer sumando
+     * @param b Segundo sumando
+     * @param resultado Suma, si no hay desbordamiento
+     * @return false si la suma no cabe en 64 bits
+     */
+    static bool sumar(Centavos a, Centavos b, Centavos& resultado);
+
+    /**
+     * @brief Resta dos cantidades
+     * @param a Minuendo
+     * @param b Sustraendo
+     * @param resultado Diferencia, si no hay desbordamiento
+     * @return false si la diferencia no cabe en 64 bits
+     */
+    static bool restar(Centavos a, Centavos b, Centavos& resultado);
+
+    /**
+     * @brief Aplica una proporción de pago (por ejemplo 3:2 o 6:5)
+     * @param cantidad Cantidad apostada, no negativa
+     * @param numerador Numerador del pago
+     * @param denominador Denominador del pago, positivo
+     * @param resultado Pago redondeado hacia abajo al centavo
+     * @return false si el pago no cabe en 64 bits
+     */
+    static bool aplicarProporcion(Centavos cantidad, int64_t numerador, int64_t denominador, Centavos& resultado);
+
+    /**
+     * @brief Interpreta una cantidad escrita en dólares ("10", "12.5", "7,25")
+     * @param texto Texto a interpretar; se ignoran los espacios alrededor
+     * @param resultado Cantidad en centavos
+     * @return false si no es una cantidad con a lo sumo dos decimales
+     */
+    static bool desdeTexto(const string& texto, Centavos& resultado);
+
+    /**
+     * @brief Convierte dólares enteros a centavos
+     * @param dolares Cantidad en dólares
+     * @return Cantidad en centavos
+     */
+    static constexpr Centavos desdeDolares(int64_t dolares) { return dolares * CENTAVOS_POR_UNIDAD; }
+
+    /**
+     * @brief Convierte centavos a dólares, solo para estadísticas y pantallas
+     * @param cantidad Cantidad en centavos
+     * @return Cantidad en dólares
+     */
+    static double aDolares(Centavos cantidad);
+
+    /**
+     * @brief Da formato a una cantidad ("1010", "12.50", "-3.05")
+     * @param cantidad Cantidad en centavos
+     * @return Dólares, con dos decimales solo si hay centavos
+     */
+    static string formatear(Centavos cantidad);
+};
+
+#endif // DINERO_H
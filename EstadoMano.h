@@ -0,0 +1,167 @@
+#ifndef ESTADO_MANO_H
+#define ESTADO_MANO_H
+
+#include "Carta.h"
+#include <array>
+#include <cstdint>
+using namespace std;
+
+/**
+ * @class EstadoMano
+ * @brief Estados de una mano de Blackjack, enumerados en tiempo de compilación
+ *
+ * Todo lo que importa de una mano para jugarla cabe en un byte de estado:
+ * vacía, una carta (A, 2 ... 10), dura 4-21, suave 12-21, Blackjack o
+ * pasada 22-30 (y 31 o más). Agregar una carta es una consulta a la tabla
+ * constexpr de transiciones (estado, rango) -> estado, y el valor, la
+ * suavidad, el Blackjack y el pasarse son consultas por estado. Las tablas
+ * ocupan menos de un kilobyte.
+ */
+class EstadoMano {
+public:
+    static constexpr uint8_t VACIA = 0;             ///< Mano sin cartas
+    static constexpr uint8_t UNA_CARTA = 1;         ///< Una carta: UNA_CARTA + índice de valor (A = 0 ... 10 = 9)
+    static constexpr uint8_t DURA = 11;             ///< Duras: DURA + (total - 4), totales 4 a 21
+    static constexpr uint8_t SUAVE = 29;            ///< Suaves: SUAVE + (total - 12), totales 12 a 21
+    static constexpr uint8_t BLACKJACK = 39;        ///< 21 con dos cartas
+    static constexpr uint8_t PASADA = 40;           ///< Pasadas: PASADA + (total - 22), totales 22 a 30
+    static constexpr uint8_t PASADA_MAXIMA = 49;    ///< Pasada con 31 o más; el valor exacto depende de las cartas
+    static constexpr int NUM_ESTADOS = 50;
+
+    /**
+     * @brief Estado de una mano a partir de sus totales
+     * @param totalDuro Suma de las cartas contando cada As como 1
+     * @param tieneAs true si la mano tiene algún As
+     * @param numCartas Número de cartas
+     * @return Estado correspondiente
+     */
+    static constexpr uint8_t desdeTotales(int totalDuro, bool tieneAs, int numCartas) {
+        if (numCartas == 0) return VACIA;
+        if (numCartas == 1) return static_cast<uint8_t>(UNA_CARTA + totalDuro - 1);
+        if (totalDuro > 21) return totalDuro > 30 ? PASADA_MAXIMA : static_cast<uint8_t>(PASADA + totalDuro - 22);
+        if (tieneAs && totalDuro <= 11) {
+            return numCartas == 2 && totalDuro == 11 ? BLACKJACK : static_cast<uint8_t>(SUAVE + totalDuro - 2);
+        }
+        return static_cast<uint8_t>(DURA + totalDuro - 4);
+    }
+
+    /**
+     * @brief Estado tras recibir una carta
+     * @param estado Estado actual
+     * @param rango Rango de la carta (0 = As ... 12 = K)
+     * @return Estado siguiente
+     */
+    static constexpr uint8_t siguiente(uint8_t estado, uint8_t rango);
+
+    /**
+     * @brief Valor de la mano en un estado
+     * @param estado Estado de la mano
+     * @return Mejor valor sin pasarse de 21 si es posible (31 para PASADA_MAXIMA)
+     */
+    static constexpr int valor(uint8_t estado);
+
+    /**
+     * @brief Verifica si un As cuenta como 11
+     * @param estado Estado de la mano
+     * @return true si la mano es suave
+     */
+    static constexpr bool esSuave(uint8_t estado);
+
+    /**
+     * @brief Verifica si la mano se pasó de 21
+     * @param estado Estado de la mano
+     * @return true si es un estado pasado
+     */
+    static constexpr bool sePaso(uint8_t estado) { return estado >= PASADA; }
+
+    /**
+     * @brief Construye la decisión del crupier para cada estado
+     * @param plantarse Valor con el que el crupier se planta
+     * @param pideSuave17 true si el crupier pide con 17 suave (H17)
+     * @return true en los estados en que el crupier pide carta
+     */
+    static constexpr array<bool, NUM_ESTADOS> construirTablaCrupier(int plantarse, bool pideSuave17 = false);
+};
+
+/**
+ * @struct TablasEstadoMano
+ * @brief Transiciones y propiedades de cada estado de EstadoMano
+ */
+struct TablasEstadoMano {
+    uint8_t siguiente[EstadoMano::NUM_ESTADOS][Carta::NUM_RANGOS] = {};  ///< (estado, rango) -> estado
+    uint8_t valores[EstadoMano::NUM_ESTADOS] = {};                       ///< Valor de la mano
+    bool suaves[EstadoMano::NUM_ESTADOS] = {};                           ///< Un As cuenta como 11
+};
+
+/**
+ * @brief Recorre cada estado con una mano representativa y le agrega cada rango
+ * @return Tablas completas
+ */
+constexpr TablasEstadoMano construirTablasEstadoMano() {
+    TablasEstadoMano tablas;
+    for (int estado = 0; estado < EstadoMano::NUM_ESTADOS; estado++) {
+        // Mano representativa: a partir de dos cartas el número exacto ya no
+        // importa, porque el Blackjack solo se alcanza desde una carta
+        int duro = 0;
+        bool tieneAs = false;
+        int numCartas = 2;
+        int valor = 0;
+        if (estado == EstadoMano::VACIA) {
+            numCartas = 0;
+        } else if (estado < EstadoMano::DURA) {
+            duro = estado - EstadoMano::UNA_CARTA + 1;
+            tieneAs = duro == 1;
+            numCartas = 1;
+            valor = tieneAs ? 11 : duro;
+        } else if (estado < EstadoMano::SUAVE) {
+            duro = estado - EstadoMano::DURA + 4;
+            valor = duro;
+        } else if (estado < EstadoMano::BLACKJACK) {
+            duro = estado - EstadoMano::SUAVE + 2;
+            tieneAs = true;
+            valor = duro + 10;
+        } else if (estado == EstadoMano::BLACKJACK) {
+            duro = 11;
+            tieneAs = true;
+            valor = 21;
+        } else {
+            duro = estado - EstadoMano::PASADA + 22;
+            valor = duro;
+        }
+        tablas.valores[estado] = static_cast<uint8_t>(valor);
+        tablas.suaves[estado] = tieneAs && duro <= 11;
+
+        for (int rango = 0; rango < Carta::NUM_RANGOS; rango++) {
+            int valorDuro = rango == 0 ? 1 : (rango < 9 ? rango + 1 : 10);
+            tablas.siguiente[estado][rango] =
+                EstadoMano::desdeTotales(duro + valorDuro, tieneAs || rango == 0, numCartas + 1);
+        }
+    }
+    return tablas;
+}
+
+inline constexpr TablasEstadoMano TABLAS_ESTADO_MANO = construirTablasEstadoMano();
+
+constexpr uint8_t EstadoMano::siguiente(uint8_t estado, uint8_t rango) {
+    return TABLAS_ESTADO_MANO.siguiente[estado][rango];
+}
+
+constexpr int EstadoMano::valor(uint8_t estado) {
+    return TABLAS_ESTADO_MANO.valores[estado];
+}
+
+constexpr bool EstadoMano::esSuave(uint8_t estado) {
+    return TABLAS_ESTADO_MANO.suaves[estado];
+}
+
+constexpr array<bool, EstadoMano::NUM_ESTADOS> EstadoMano::construirTablaCrupier(int plantarse, bool pideSuave17) {
+    array<bool, NUM_ESTADOS> pide{};
+    for (int estado = 0; estado < NUM_ESTADOS; estado++) {
+        uint8_t e = static_cast<uint8_t>(estado);
+        bool suave17 = pideSuave17 && esSuave(e) && valor(e) == 17;
+        pide[estado] = estado != BLACKJACK && !sePaso(e) && (valor(e) < plantarse || suave17);
+    }
+    return pide;
+}
+
+#endif // ESTADO_MANO_H
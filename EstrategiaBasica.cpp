@@ -0,0 +1,212 @@
+#include "EstrategiaBasica.h"
+#include <fstream>
+#include <sstream>
+using namespace std;
+
+namespace {
+    /**
+     * Filas de la estrategia básica en el orden habitual de las tablas:
+     * cada carácter corresponde a la carta del crupier 2, 3, ..., 10, A
+     */
+    constexpr const char* DURAS[18] = {
+        "HHHHHHHHHH",  //  4
+        "HHHHHHHHHH",  //  5
+        "HHHHHHHHHH",  //  6
+        "HHHHHHHHHH",  //  7
+        "HHHHHHHHHH",  //  8
+        "HDDDDHHHHH",  //  9
+        "DDDDDDDDHH",  // 10
+        "DDDDDDDDDH",  // 11
+        "HHSSSHHHHH",  // 12
+        "SSSSSHHHHH",  // 13
+        "SSSSSHHHHH",  // 14
+        "SSSSSHHHRH",  // 15
+        "SSSSSHHRRR",  // 16
+        "SSSSSSSSSS",  // 17
+        "SSSSSSSSSS",  // 18
+        "SSSSSSSSSS",  // 19
+        "SSSSSSSSSS",  // 20
+        "SSSSSSSSSS"   // 21
+    };
+
+    constexpr const char* SUAVES[10] = {
+        "HHHHHHHHHH",  // 12
+        "HHHDDHHHHH",  // 13
+        "HHHDDHHHHH",  // 14
+        "HHDDDHHHHH",  // 15
+        "HHDDDHHHHH",  // 16
+        "HDDDDHHHHH",  // 17
+        "SddddSSHHH",  // 18
+        "SSSSSSSSSS",  // 19
+        "SSSSSSSSSS",  // 20
+        "SSSSSSSSSS"   // 21
+    };
+
+    constexpr const char* PARES[10] = {
+        "PPPPPPPPPP",  // A,A
+        "PPPPPPHHHH",  // 2,2
+        "PPPPPPHHHH",  // 3,3
+        "HHHPPHHHHH",  // 4,4
+        "DDDDDDDDHH",  // 5,5
+        "PPPPPHHHHH",  // 6,6
+        "PPPPPPHHHH",  // 7,7
+        "PPPPPPPPPP",  // 8,8
+        "PPPPPSPPSS",  // 9,9
+        "SSSSSSSSSS"   // 10,10
+    };
+
+    /**
+     * Convierte un carácter de tabla en una acción
+     * Retorna false si el carácter no es válido
+     */
+    constexpr bool accionDesdeCaracter(char c, Accion& accion) {
+        switch (c) {
+            case 'H': accion = Accion::PEDIR; return true;
+            case 'S': accion = Accion::PLANTARSE; return true;
+            case 'D': accion = Accion::DOBLAR; return true;
+            case 'd': accion = Accion::DOBLAR_O_PLANTARSE; return true;
+            case 'P': accion = Accion::DIVIDIR; return true;
+            case 'R': accion = Accion::RENDIRSE; return true;
+            default: return false;
+        }
+    }
+
+    /**
+     * Índice de valor (0 = As) de la columna i del texto (2, 3, ..., 10, A)
+     */
+    constexpr int columnaAIndiceValor(int columna) {
+        return columna == 9 ? 0 : columna + 1;
+    }
+
+    constexpr void copiarFila(EstrategiaBasica::Tabla& tabla, int fila, const char* texto) {
+        for (int columna = 0; columna < Carta::NUM_VALORES; columna++) {
+            Accion accion = Accion::PLANTARSE;
+            accionDesdeCaracter(texto[columna], accion);
+            tabla[fila][columnaAIndiceValor(columna)] = accion;
+        }
+    }
+
+    constexpr EstrategiaBasica::Tabla construirTablaPorDefecto() {
+        EstrategiaBasica::Tabla tabla{};
+        for (int i = 0; i < 18; i++) copiarFila(tabla, EstrategiaBasica::FILA_DURAS + i, DURAS[i]);
+        for (int i = 0; i < 10; i++) copiarFila(tabla, EstrategiaBasica::FILA_SUAVES + i, SUAVES[i]);
+        for (int i = 0; i < 10; i++) copiarFila(tabla, EstrategiaBasica::FILA_PARES + i, PARES[i]);
+        return tabla;
+    }
+
+    constexpr EstrategiaBasica::Tabla TABLA_POR_DEFECTO = construirTablaPorDefecto();
+}
+
+/**
+ * Constructor que carga la tabla por defecto
+ */
+EstrategiaBasica::EstrategiaBasica() : tabla(TABLA_POR_DEFECTO) {}
+
+/**
+ * Constructor que copia una tabla completa
+ */
+EstrategiaBasica::EstrategiaBasica(const Tabla& tabla) : tabla(tabla) {}
+
+/**
+ * Getter de una celda de la tabla
+ */
+Accion EstrategiaBasica::obtenerAccion(int fila, int indiceValorCrupier) const {
+    return tabla[fila][indiceValorCrupier];
+}
+
+/**
+ * Setter de una celda de la tabla
+ */
+void EstrategiaBasica::establecerAccion(int fila, int indiceValorCrupier, Accion accion) {
+    tabla[fila][indiceValorCrupier] = accion;
+}
+
+/**
+ * Carga la estrategia desde un archivo de texto
+ * Se trabaja sobre una copia para no dejar la tabla a medias si hay errores
+ */
+bool EstrategiaBasica::cargarDesdeArchivo(const string& ruta) {
+    ifstream archivo(ruta);
+    if (!archivo) {
+        return false;
+    }
+
+    Tabla nueva = tabla;
+    string linea;
+    while (getline(archivo, linea)) {
+        if (linea.empty() || linea[0] == '#') {
+            continue;
+        }
+
+        stringstream ss(linea);
+        string tipo, total;
+        if (!(ss >> tipo >> total)) {
+            return false;
+        }
+
+        int fila;
+        if (tipo == "PAR") {
+            int valor = (total == "A") ? 1 : atoi(total.c_str());
+            if (valor < 1 || valor > 10) return false;
+            fila = FILA_PARES + valor - 1;
+        } else {
+            int valor = atoi(total.c_str());
+            if (tipo == "DURA" && valor >= 4 && valor <= 21) {
+                fila = FILA_DURAS + valor - 4;
+            } else if (tipo == "SUAVE" && valor >= 12 && valor <= 21) {
+                fila = FILA_SUAVES + valor - 12;
+            } else {
+                return false;
+            }
+        }
+
+        for (int columna = 0; columna < Carta::NUM_VALORES; columna++) {
+            string codigo;
+            Accion accion;
+            if (!(ss >> codigo) || codigo.size() != 1 || !accionDesdeCaracter(codigo[0], accion)) {
+                return false;
+            }
+            nueva[fila][columnaAIndiceValor(columna)] = accion;
+        }
+    }
+
+    tabla = nueva;
+    return true;
+}
+
+/**
+ * Tabla de estrategia básica construida en tiempo de compilación
+ */
+const EstrategiaBasica::Tabla& EstrategiaBasica::tablaPorDefecto() {
+    return TABLA_POR_DEFECTO;
+}
+
+/**
+ * Pedir con menos de 17, igual que el crupier, sin doblar ni dividir
+ */
+EstrategiaBasica EstrategiaBasica::imitarCrupier() {
+    Tabla tabla{};
+    for (int total = 4; total <= 21; total++) {
+        tabla[FILA_DURAS + total - 4].fill(total < 17 ? Accion::PEDIR : Accion::PLANTARSE);
+    }
+    for (int total = 12; total <= 21; total++) {
+        tabla[FILA_SUAVES + total - 12].fill(total < 17 ? Accion::PEDIR : Accion::PLANTARSE);
+    }
+    for (int valor = 0; valor < Carta::NUM_VALORES; valor++) {
+        // Una pareja se juega por su total: A,A = 12 suave, 10,10 = 20
+        int total = (valor == 0) ? 12 : 2 * (valor + 1);
+        tabla[FILA_PARES + valor].fill(total < 17 ? Accion::PEDIR : Accion::PLANTARSE);
+    }
+    return EstrategiaBasica(tabla);
+}
+
+/**
+ * Plantarse con cualquier mano
+ */
+EstrategiaBasica EstrategiaBasica::plantarseSiempre() {
+    Tabla tabla{};
+    for (auto& fila : tabla) {
+        fila.fill(Accion::PLANTARSE);
+    }
+    return EstrategiaBasica(tabla);
+}
@@ -0,0 +1,138 @@
+#ifndef ESTRATEGIA_BASICA_H
+#define ESTRATEGIA_BASICA_H
+
+#include "Mano.h"
+#include <array>
+#include <cstdint>
+#include <string>
+using namespace std;
+
+/**
+ * @enum Accion
+ * @brief Decisiones posibles de un jugador sobre su mano
+ */
+enum class Accion : uint8_t {
+    PLANTARSE,           ///< No pedir más cartas
+    PEDIR,               ///< Pedir una carta
+    DOBLAR,              ///< Doblar la apuesta si se permite; si no, pedir
+    DOBLAR_O_PLANTARSE,  ///< Doblar la apuesta si se permite; si no, plantarse
+    DIVIDIR,             ///< Dividir la pareja
+    RENDIRSE             ///< Rendirse si se permite; si no, pedir
+};
+
+/**
+ * @class EstrategiaBasica
+ * @brief Estrategia de juego basada en una tabla de decisiones
+ *
+ * La decisión se obtiene leyendo una tabla compacta indexada por el tipo
+ * de mano (total duro, total suave o pareja) y la carta visible del
+ * crupier, sin llamadas virtuales por carta. La tabla por defecto es la
+ * estrategia básica para varias barajas con el crupier plantándose en 17,
+ * doblar después de dividir y rendición tardía.
+ */
+class EstrategiaBasica {
+public:
+    static constexpr int FILA_DURAS = 0;     ///< Filas 0-17: totales duros 4-21
+    static constexpr int FILA_SUAVES = 18;   ///< Filas 18-27: totales suaves 12-21
+    static constexpr int FILA_PARES = 28;    ///< Filas 28-37: parejas A, 2-9, 10
+    static constexpr int NUM_FILAS = 38;     ///< Filas de la tabla
+
+    using Tabla = array<array<Accion, Carta::NUM_VALORES>, NUM_FILAS>;
+
+private:
+    Tabla tabla;  ///< Acción por fila y valor de la carta visible del crupier
+
+public:
+    /**
+     * @brief Constructor de la clase EstrategiaBasica
+     * @post Carga la tabla de estrategia básica por defecto
+     */
+    EstrategiaBasica();
+
+    /**
+     * @brief Constructor a partir de una tabla completa
+     * @param tabla Tabla de decisiones
+     */
+    explicit EstrategiaBasica(const Tabla& tabla);
+
+    /**
+     * @brief Calcula la fila de la tabla que corresponde a una mano
+     * @param mano Mano del jugador
+     * @param puedeDividir true si una pareja puede dividirse
+     * @return Índice de fila en la tabla
+     */
+    static int filaPara(const Mano& mano, bool puedeDividir) {
+        int total = mano.calcularValor();
+        if (puedeDividir && mano.esPar()) {
+            return FILA_PARES + mano.obtenerCartas()[0].obtenerIndiceValor();
+        }
+        if (mano.esSuave()) {
+            return FILA_SUAVES + (total > 12 ? total - 12 : 0);
+        }
+        return FILA_DURAS + (total < 4 ? 0 : (total > 21 ? 17 : total - 4));
+    }
+
+    /**
+     * @brief Decide la acción para una mano (lectura directa de la tabla)
+     * @param mano Mano del jugador
+     * @param cartaVisibleCrupier Carta descubierta del crupier
+     * @param puedeDividir true si una pareja puede dividirse
+     * @param puedeRendirse true si las reglas y la mano permiten rendirse
+     * @return Acción recomendada; RENDIRSE se convierte en PEDIR si no se puede rendir
+     */
+    Accion decidir(const Mano& mano, Carta cartaVisibleCrupier, bool puedeDividir = true,
+                   bool puedeRendirse = false) const {
+        Accion accion = tabla[filaPara(mano, puedeDividir)][cartaVisibleCrupier.obtenerIndiceValor()];
+        return accion == Accion::RENDIRSE && !puedeRendirse ? Accion::PEDIR : accion;
+    }
+
+    /**
+     * @brief Obtiene la acción de una celda concreta
+     * @param fila Fila de la tabla
+     * @param indiceValorCrupier Índice de valor de la carta del crupier (0 = As)
+     * @return Acción almacenada
+     */
+    Accion obtenerAccion(int fila, int indiceValorCrupier) const;
+
+    /**
+     * @brief Cambia la acción de una celda concreta
+     * @param fila Fila de la tabla
+     * @param indiceValorCrupier Índice de valor de la carta del crupier (0 = As)
+     * @param accion Acción a guardar
+     */
+    void establecerAccion(int fila, int indiceValorCrupier, Accion accion);
+
+    /**
+     * @brief Carga una estrategia desde un archivo de texto
+     * @param ruta Ruta del archivo
+     * @return true si el archivo se leyó por completo, false en caso contrario
+     * @post Si falla, la tabla actual no se modifica
+     *
+     * Cada línea tiene un tipo (DURA, SUAVE o PAR), un total (o el valor de
+     * la pareja: A, 2-10) y diez acciones para la carta del crupier de 2 a A:
+     * H = pedir, S = plantarse, D = doblar/pedir, d = doblar/plantarse,
+     * P = dividir, R = rendirse/pedir. Las líneas vacías o que empiezan con # se ignoran.
+     * Las filas que no aparecen conservan su valor por defecto.
+     */
+    bool cargarDesdeArchivo(const string& ruta);
+
+    /**
+     * @brief Obtiene la tabla de estrategia básica por defecto
+     * @return Tabla constante generada en tiempo de compilación
+     */
+    static const Tabla& tablaPorDefecto();
+
+    /**
+     * @brief Estrategia que imita al crupier (pedir con menos de 17)
+     * @return Estrategia sin doblar ni dividir
+     */
+    static EstrategiaBasica imitarCrupier();
+
+    /**
+     * @brief Estrategia que nunca pide carta
+     * @return Estrategia que siempre se planta
+     */
+    static EstrategiaBasica plantarseSiempre();
+};
+
+#endif // ESTRATEGIA_BASICA_H
@@ -0,0 +1,183 @@
+#include "EvaluadorManos.h"
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EVALUADOR_MANOS_X86 1
+#endif
+using namespace std;
+
+namespace {
+    // Valor duro de cada rango (el As cuenta 1); los rangos inválidos valen 0
+    const uint8_t VALORES_DUROS[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 0, 0, 0};
+}
+
+/**
+ * Mismas reglas que Mano: un As vale 11 solo si no se pasa de 21, y el
+ * Blackjack exige exactamente dos cartas
+ */
+void EvaluadorManos::evaluarEscalar(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                                    uint8_t* totales, uint8_t* banderas) {
+    for (size_t i = 0; i < numManos; i++) {
+        int duro = 0;
+        int cartas = 0;
+        int ases = 0;
+        for (int c = 0; c < cartasPorMano; c++) {
+            uint8_t rango = rangos[static_cast<size_t>(c) * paso + i];
+            int valida = rango < Carta::NUM_RANGOS;
+            duro += valida ? VALORES_DUROS[rango] : 0;
+            cartas += valida;
+            ases |= rango == 0;
+        }
+        int suave = ases & (duro <= 11);
+        int blackjack = ases & (cartas == 2) & (duro == 11);
+        totales[i] = static_cast<uint8_t>(duro + 10 * suave);
+        banderas[i] = static_cast<uint8_t>(suave * SUAVE | (duro > 21) * PASADA | blackjack * BLACKJACK);
+    }
+}
+
+#ifdef EVALUADOR_MANOS_X86
+/**
+ * Cada carril de byte es una mano. El valor de la carta sale de una tabla
+ * de 16 entradas con vpshufb (SIN_CARTA tiene el bit alto y da 0), y las
+ * comparaciones sin signo se hacen con min_epu8 + cmpeq
+ */
+__attribute__((target("avx2")))
+void EvaluadorManos::evaluarAVX2(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                                 uint8_t* totales, uint8_t* banderas) {
+    const __m256i tabla = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(VALORES_DUROS)));
+    const __m256i cero = _mm256_setzero_si256();
+    const __m256i ultimoRango = _mm256_set1_epi8(Carta::NUM_RANGOS - 1);
+    const __m256i once = _mm256_set1_epi8(11);
+    const __m256i veintiuno = _mm256_set1_epi8(21);
+    const __m256i dos = _mm256_set1_epi8(2);
+    const __m256i diez = _mm256_set1_epi8(10);
+
+    size_t i = 0;
+    for (; i + 32 <= numManos; i += 32) {
+        __m256i duro = cero;
+        __m256i cartas = cero;
+        __m256i ases = cero;
+        for (int c = 0; c < cartasPorMano; c++) {
+            __m256i rango = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(rangos + static_cast<size_t>(c) * paso + i));
+            __m256i valida = _mm256_cmpeq_epi8(_mm256_min_epu8(rango, ultimoRango), rango);
+            duro = _mm256_add_epi8(duro, _mm256_and_si256(_mm256_shuffle_epi8(tabla, rango), valida));
+            cartas = _mm256_sub_epi8(cartas, valida);  // valida es -1 en cada carta
+            ases = _mm256_or_si256(ases, _mm256_cmpeq_epi8(rango, cero));
+        }
+
+        __m256i suave = _mm256_and_si256(ases, _mm256_cmpeq_epi8(_mm256_min_epu8(duro, once), duro));
+        __m256i noPasada = _mm256_cmpeq_epi8(_mm256_min_epu8(duro, veintiuno), duro);
+        __m256i blackjack = _mm256_and_si256(_mm256_and_si256(ases, _mm256_cmpeq_epi8(cartas, dos)),
+                                             _mm256_cmpeq_epi8(duro, once));
+        __m256i total = _mm256_add_epi8(duro, _mm256_and_si256(suave, diez));
+        __m256i bandera = _mm256_or_si256(
+            _mm256_and_si256(suave, _mm256_set1_epi8(SUAVE)),
+            _mm256_or_si256(_mm256_andnot_si256(noPasada, _mm256_set1_epi8(PASADA)),
+                            _mm256_and_si256(blackjack, _mm256_set1_epi8(BLACKJACK))));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(totales + i), total);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(banderas + i), bandera);
+    }
+    evaluarEscalar(rangos + i, paso, numManos - i, cartasPorMano, totales + i, banderas + i);
+}
+#else
+/**
+ * Sin x86 no hay núcleo AVX2
+ */
+void EvaluadorManos::evaluarAVX2(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                                 uint8_t* totales, uint8_t* banderas) {
+    evaluarEscalar(rangos, paso, numManos, cartasPorMano, totales, banderas);
+}
+#endif
+
+/**
+ * La consulta a la CPU se hace una sola vez
+ */
+bool EvaluadorManos::admiteAVX2() {
+#ifdef EVALUADOR_MANOS_X86
+    static const bool admite = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return admite;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Elige el núcleo en tiempo de ejecución
+ */
+void EvaluadorManos::evaluarLote(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                                 uint8_t* totales, uint8_t* banderas) {
+    if (admiteAVX2()) {
+        evaluarAVX2(rangos, paso, numManos, cartasPorMano, totales, banderas);
+    } else {
+        evaluarEscalar(rangos, paso, numManos, cartasPorMano, totales, banderas);
+    }
+}
+
+/**
+ * Copia los rangos de cada mano en su columna
+ */
+bool EvaluadorManos::cargar(const vector<Mano>& manos) {
+    int maximo = 0;
+    for (const Mano& mano : manos) {
+        maximo = max(maximo, mano.obtenerNumeroCartas());
+    }
+    totales.clear();
+    banderas.clear();
+    if (maximo > MAX_CARTAS) {
+        rangos.clear();
+        numManos = 0;
+        cartasPorMano = 0;
+        return false;
+    }
+
+    numManos = manos.size();
+    cartasPorMano = maximo;
+    rangos.assign(numManos * static_cast<size_t>(cartasPorMano), SIN_CARTA);
+    for (size_t i = 0; i < numManos; i++) {
+        const vector<Carta>& cartas = manos[i].obtenerCartas();
+        for (size_t c = 0; c < cartas.size(); c++) {
+            rangos[c * numManos + i] = cartas[c].obtenerRango();
+        }
+    }
+    return true;
+}
+
+/**
+ * Evalúa el lote cargado
+ */
+void EvaluadorManos::evaluar() {
+    totales.resize(numManos);
+    banderas.resize(numManos);
+    evaluarLote(rangos.data(), numManos, numManos, cartasPorMano, totales.data(), banderas.data());
+}
+
+/**
+ * Getter del número de manos
+ */
+size_t EvaluadorManos::obtenerNumManos() const {
+    return numManos;
+}
+
+/**
+ * Getter de los rangos
+ */
+const vector<uint8_t>& EvaluadorManos::obtenerRangos() const {
+    return rangos;
+}
+
+/**
+ * Getter de los totales
+ */
+const vector<uint8_t>& EvaluadorManos::obtenerTotales() const {
+    return totales;
+}
+
+/**
+ * Getter de las banderas
+ */
+const vector<uint8_t>& EvaluadorManos::obtenerBanderas() const {
+    return banderas;
+}
@@ -0,0 +1,114 @@
+#ifndef EVALUADOR_MANOS_H
+#define EVALUADOR_MANOS_H
+
+#include "Mano.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+/**
+ * @class EvaluadorManos
+ * @brief Evaluación por lotes de miles de manos sobre rangos empaquetados
+ *
+ * Los rangos se guardan por columnas: la fila c contiene el rango de la
+ * carta c de cada mano (rangos[c * paso + mano]), con SIN_CARTA donde la
+ * mano tiene menos cartas. Así cada carga AVX2 trae la misma carta de 32
+ * manos y el lote completo se evalúa sin ramas.
+ *
+ * El núcleo AVX2 se elige en tiempo de ejecución si la CPU lo admite; en
+ * otro caso se usa el núcleo escalar. Ambos dan exactamente los mismos
+ * resultados que Mano::calcularValor, Mano::esSuave, Mano::sePaso y
+ * Mano::esBlackjack.
+ */
+class EvaluadorManos {
+public:
+    static constexpr uint8_t SIN_CARTA = 0xFF;  ///< Hueco de una mano con menos cartas
+    static constexpr int MAX_CARTAS = 25;       ///< 25 dieces aún caben en un byte
+
+    static constexpr uint8_t SUAVE = 1;         ///< Bandera: un As vale 11
+    static constexpr uint8_t PASADA = 2;        ///< Bandera: la mano pasa de 21
+    static constexpr uint8_t BLACKJACK = 4;     ///< Bandera: 21 con dos cartas
+
+private:
+    vector<uint8_t> rangos;     ///< Rangos por columnas (cartasPorMano filas de numManos)
+    vector<uint8_t> totales;    ///< Valor de cada mano
+    vector<uint8_t> banderas;   ///< Banderas SUAVE, PASADA y BLACKJACK de cada mano
+    size_t numManos = 0;        ///< Manos cargadas
+    int cartasPorMano = 0;      ///< Filas de rangos
+
+public:
+    /**
+     * @brief Evalúa un lote con el mejor núcleo disponible
+     * @param rangos Rangos por columnas: rangos[c * paso + i] es la carta c de la mano i
+     * @param paso Distancia entre filas, al menos numManos
+     * @param numManos Número de manos
+     * @param cartasPorMano Número de filas
+     * @param totales Salida: valor de cada mano
+     * @param banderas Salida: banderas de cada mano
+     * @pre Cada rango es menor que Carta::NUM_RANGOS o SIN_CARTA, y cartasPorMano <= MAX_CARTAS
+     */
+    static void evaluarLote(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                            uint8_t* totales, uint8_t* banderas);
+
+    /**
+     * @brief Núcleo escalar, disponible en cualquier CPU
+     * @pre Las mismas que evaluarLote
+     */
+    static void evaluarEscalar(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                               uint8_t* totales, uint8_t* banderas);
+
+    /**
+     * @brief Núcleo AVX2, 32 manos por iteración; el resto lo evalúa el escalar
+     * @pre Las mismas que evaluarLote, y admiteAVX2()
+     * @post Fuera de x86 equivale a evaluarEscalar
+     */
+    static void evaluarAVX2(const uint8_t* rangos, size_t paso, size_t numManos, int cartasPorMano,
+                            uint8_t* totales, uint8_t* banderas);
+
+    /**
+     * @brief Verifica si la CPU admite AVX2
+     * @return true si evaluarLote usa el núcleo AVX2
+     */
+    static bool admiteAVX2();
+
+    /**
+     * @brief Empaqueta los rangos de un conjunto de manos
+     * @param manos Manos a evaluar
+     * @return false si alguna mano tiene más de MAX_CARTAS cartas; el lote queda vacío
+     * @post Los resultados anteriores se descartan hasta llamar a evaluar()
+     */
+    bool cargar(const vector<Mano>& manos);
+
+    /**
+     * @brief Evalúa las manos cargadas
+     * @post obtenerTotales() y obtenerBanderas() tienen una entrada por mano
+     */
+    void evaluar();
+
+    /**
+     * @brief Obtiene el número de manos cargadas
+     * @return Número de manos
+     */
+    size_t obtenerNumManos() const;
+
+    /**
+     * @brief Obtiene los rangos empaquetados
+     * @return Rangos por columnas, con paso obtenerNumManos()
+     */
+    const vector<uint8_t>& obtenerRangos() const;
+
+    /**
+     * @brief Obtiene el valor de cada mano
+     * @return Totales, como Mano::calcularValor
+     */
+    const vector<uint8_t>& obtenerTotales() const;
+
+    /**
+     * @brief Obtiene las banderas de cada mano
+     * @return Combinación de SUAVE, PASADA y BLACKJACK
+     */
+    const vector<uint8_t>& obtenerBanderas() const;
+};
+
+#endif // EVALUADOR_MANOS_H
@@ -0,0 +1,185 @@
+#include "GeneradorAleatorio.h"
+#include <chrono>
+#include <random>
+using namespace std;
+
+namespace {
+    constexpr size_t TAMANO_BLOQUE = 32;  // Números de 64 bits generados por lote
+
+    inline uint64_t rotarIzquierda(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+}
+
+/**
+ * Implementación por defecto del llenado en bloque
+ */
+void GeneradorAleatorio::llenar(uint64_t* destino, size_t cantidad) {
+    for (size_t i = 0; i < cantidad; i++) {
+        destino[i] = siguiente();
+    }
+}
+
+/**
+ * Genera los índices de Fisher-Yates usando bloques de números aleatorios
+ * Cada número de 64 bits aporta dos valores de 32 bits, que se reducen al
+ * rango [0, i] con la multiplicación de Lemire (rechazo exacto, sin sesgo)
+ */
+void GeneradorAleatorio::generarIndicesBarajado(uint32_t* destino, uint32_t n) {
+    uint64_t bloque[TAMANO_BLOQUE];
+    size_t disponibles = 0;  // Mitades de 32 bits sin usar en el bloque
+
+    auto siguiente32 = [&]() -> uint32_t {
+        if (disponibles == 0) {
+            llenar(bloque, TAMANO_BLOQUE);
+            disponibles = TAMANO_BLOQUE * 2;
+        }
+        disponibles--;
+        uint64_t palabra = bloque[disponibles >> 1];
+        return static_cast<uint32_t>((disponibles & 1) ? palabra >> 32 : palabra);
+    };
+
+    for (uint32_t i = n; i-- > 1;) {
+        uint32_t rango = i + 1;
+        uint64_t producto = static_cast<uint64_t>(siguiente32()) * rango;
+        uint32_t bajo = static_cast<uint32_t>(producto);
+        if (bajo < rango) {
+            uint32_t umbral = (0u - rango) % rango;
+            while (bajo < umbral) {
+                producto = static_cast<uint64_t>(siguiente32()) * rango;
+                bajo = static_cast<uint32_t>(producto);
+            }
+        }
+        destino[i] = static_cast<uint32_t>(producto >> 32);
+    }
+    if (n > 0) {
+        destino[0] = 0;
+    }
+}
+
+/**
+ * Obtiene una semilla del dispositivo aleatorio mezclada con el reloj
+ */
+uint64_t GeneradorAleatorio::semillaDelSistema() {
+    random_device dispositivo;
+    uint64_t semilla = (static_cast<uint64_t>(dispositivo()) << 32) ^ dispositivo();
+    return semilla ^ static_cast<uint64_t>(chrono::steady_clock::now().time_since_epoch().count());
+}
+
+/**
+ * SplitMix64: convierte una semilla cualquiera en estado bien mezclado
+ */
+uint64_t GeneradorAleatorio::splitMix64(uint64_t& estado) {
+    uint64_t z = (estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Constructor que siembra el generador xoshiro256**
+ */
+Xoshiro256EstrellaEstrella::Xoshiro256EstrellaEstrella(uint64_t semilla) {
+    sembrar(semilla);
+}
+
+/**
+ * Expande la semilla a los 256 bits de estado con SplitMix64
+ */
+void Xoshiro256EstrellaEstrella::sembrar(uint64_t semilla) {
+    for (uint64_t& palabra : estado) {
+        palabra = splitMix64(semilla);
+    }
+}
+
+/**
+ * Paso de xoshiro256**
+ */
+uint64_t Xoshiro256EstrellaEstrella::siguiente() {
+    const uint64_t resultado = rotarIzquierda(estado[1] * 5, 7) * 9;
+    const uint64_t t = estado[1] << 17;
+
+    estado[2] ^= estado[0];
+    estado[3] ^= estado[1];
+    estado[1] ^= estado[2];
+    estado[0] ^= estado[3];
+    estado[2] ^= t;
+    estado[3] = rotarIzquierda(estado[3], 45);
+
+    return resultado;
+}
+
+/**
+ * Llenado en bloque sin llamadas virtuales por número
+ */
+void Xoshiro256EstrellaEstrella::llenar(uint64_t* destino, size_t cantidad) {
+    for (size_t i = 0; i < cantidad; i++) {
+        destino[i] = Xoshiro256EstrellaEstrella::siguiente();
+    }
+}
+
+/**
+ * Salto equivalente a 2^128 llamadas a siguiente()
+ */
+void Xoshiro256EstrellaEstrella::saltar() {
+    static constexpr uint64_t SALTO[] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (uint64_t salto : SALTO) {
+        for (int b = 0; b < 64; b++) {
+            if (salto & (1ULL << b)) {
+                s0 ^= estado[0];
+                s1 ^= estado[1];
+                s2 ^= estado[2];
+                s3 ^= estado[3];
+            }
+            Xoshiro256EstrellaEstrella::siguiente();
+        }
+    }
+    estado[0] = s0;
+    estado[1] = s1;
+    estado[2] = s2;
+    estado[3] = s3;
+}
+
+/**
+ * Constructor que siembra el generador PCG32
+ */
+Pcg32::Pcg32(uint64_t semilla) : estado(0), incremento(1) {
+    sembrar(semilla);
+}
+
+/**
+ * Inicializa estado y secuencia a partir de la semilla
+ */
+void Pcg32::sembrar(uint64_t semilla) {
+    uint64_t mezcla = semilla;
+    uint64_t estadoInicial = splitMix64(mezcla);
+    incremento = (splitMix64(mezcla) << 1) | 1u;
+    estado = 0;
+    siguiente32();
+    estado += estadoInicial;
+    siguiente32();
+}
+
+/**
+ * Paso de PCG-XSH-RR
+ */
+uint32_t Pcg32::siguiente32() {
+    uint64_t anterior = estado;
+    estado = anterior * 6364136223846793005ULL + incremento;
+    uint32_t desplazado = static_cast<uint32_t>(((anterior >> 18) ^ anterior) >> 27);
+    uint32_t rotacion = static_cast<uint32_t>(anterior >> 59);
+    return (desplazado >> rotacion) | (desplazado << ((0u - rotacion) & 31));
+}
+
+/**
+ * Combina dos salidas de 32 bits en un número de 64 bits
+ */
+uint64_t Pcg32::siguiente() {
+    uint64_t alto = siguiente32();
+    return (alto << 32) | siguiente32();
+}
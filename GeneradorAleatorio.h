@@ -0,0 +1,131 @@
+#ifndef GENERADOR_ALEATORIO_H
+#define GENERADOR_ALEATORIO_H
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+using namespace std;
+
+/**
+ * @class GeneradorAleatorio
+ * @brief Interfaz para los generadores de números aleatorios usados al barajar
+ *
+ * Permite cambiar el motor del Mazo sin tocar el algoritmo de barajado.
+ * Las llamadas virtuales se hacen una vez por bloque de números, no por
+ * carta, gracias al camino en lote de generarIndicesBarajado().
+ * Cumple con UniformRandomBitGenerator para usarse con la biblioteca estándar.
+ */
+class GeneradorAleatorio {
+public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Destructor virtual para permitir herencia
+     */
+    virtual ~GeneradorAleatorio() = default;
+
+    /**
+     * @brief Reinicia el estado interno a partir de una semilla
+     * @param semilla Semilla de 64 bits
+     * @post La secuencia generada queda determinada por la semilla
+     */
+    virtual void sembrar(uint64_t semilla) = 0;
+
+    /**
+     * @brief Genera el siguiente número de 64 bits
+     * @return Número pseudoaleatorio uniforme
+     */
+    virtual uint64_t siguiente() = 0;
+
+    /**
+     * @brief Llena un bloque con números de 64 bits
+     * @param destino Arreglo de salida
+     * @param cantidad Número de valores a generar
+     * @post Equivale a llamar siguiente() cantidad veces
+     */
+    virtual void llenar(uint64_t* destino, size_t cantidad);
+
+    /**
+     * @brief Genera los índices de intercambio de Fisher-Yates en lote
+     * @param destino Arreglo de salida con al menos n posiciones
+     * @param n Número de elementos a barajar
+     * @post destino[i] es uniforme en [0, i] para todo 1 <= i < n
+     */
+    void generarIndicesBarajado(uint32_t* destino, uint32_t n);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return numeric_limits<result_type>::max(); }
+    result_type operator()() { return siguiente(); }
+
+    /**
+     * @brief Obtiene una semilla no determinista del sistema
+     * @return Semilla de 64 bits
+     */
+    static uint64_t semillaDelSistema();
+
+    /**
+     * @brief Paso de SplitMix64, usado para expandir semillas
+     * @param estado Estado que se avanza en cada llamada
+     * @return Siguiente valor de la secuencia SplitMix64
+     */
+    static uint64_t splitMix64(uint64_t& estado);
+};
+
+/**
+ * @class Xoshiro256EstrellaEstrella
+ * @brief Generador xoshiro256** (Blackman y Vigna)
+ *
+ * Periodo 2^256 - 1, muy rápido y de buena calidad estadística.
+ * Es el motor por defecto del Mazo.
+ */
+class Xoshiro256EstrellaEstrella : public GeneradorAleatorio {
+private:
+    uint64_t estado[4];  ///< Estado interno de 256 bits
+
+public:
+    /**
+     * @brief Constructor de la clase Xoshiro256EstrellaEstrella
+     * @param semilla Semilla inicial
+     */
+    explicit Xoshiro256EstrellaEstrella(uint64_t semilla = 0);
+
+    void sembrar(uint64_t semilla) override;
+    uint64_t siguiente() override;
+    void llenar(uint64_t* destino, size_t cantidad) override;
+
+    /**
+     * @brief Avanza el estado 2^128 pasos
+     * @post Sirve para obtener secuencias independientes a partir de una semilla
+     */
+    void saltar();
+};
+
+/**
+ * @class Pcg32
+ * @brief Generador PCG-XSH-RR de 64 bits de estado y 32 de salida (O'Neill)
+ *
+ * Cada número de 64 bits se forma con dos salidas de 32 bits.
+ */
+class Pcg32 : public GeneradorAleatorio {
+private:
+    uint64_t estado;      ///< Estado del generador congruencial
+    uint64_t incremento;  ///< Incremento (siempre impar) que selecciona la secuencia
+
+    /**
+     * @brief Genera la siguiente salida de 32 bits
+     * @return Número pseudoaleatorio de 32 bits
+     */
+    uint32_t siguiente32();
+
+public:
+    /**
+     * @brief Constructor de la clase Pcg32
+     * @param semilla Semilla inicial
+     */
+    explicit Pcg32(uint64_t semilla = 0);
+
+    void sembrar(uint64_t semilla) override;
+    uint64_t siguiente() override;
+};
+
+#endif // GENERADOR_ALEATORIO_H
@@ -0,0 +1,402 @@
+#include "HistorialBinario.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+namespace {
+    constexpr uint8_t CABECERA[EscritorHistorial::TAMANO_CABECERA] = {
+        'B', 'J', 'H', EscritorHistorial::VERSION
+    };
+    constexpr size_t LIMITE_BUFFER = 1 << 16;  // Bytes acumulados antes de escribir
+
+    /**
+     * Lee un entero little-endian de 'bytes' bytes
+     */
+    uint64_t leerEntero(const uint8_t* origen, int bytes) {
+        uint64_t valor = 0;
+        for (int i = bytes - 1; i >= 0; i--) {
+            valor = (valor << 8) | origen[i];
+        }
+        return valor;
+    }
+}
+
+/**
+ * Constructor sin archivo abierto
+ */
+EscritorHistorial::EscritorHistorial() {
+    buffer.reserve(LIMITE_BUFFER + 16);
+}
+
+/**
+ * Destructor que escribe lo pendiente
+ */
+EscritorHistorial::~EscritorHistorial() {
+    vaciar();
+}
+
+/**
+ * Abre el archivo para agregar y escribe la cabecera si está vacío; un
+ * archivo con datos solo se acepta si empieza con la cabecera de esta versión
+ */
+bool EscritorHistorial::abrir(const string& ruta) {
+    vaciar();
+    archivo.close();
+    buffer.clear();
+
+    struct stat informacion;
+    bool vacio = stat(ruta.c_str(), &informacion) != 0 || informacion.st_size == 0;
+    if (!vacio) {
+        char cabecera[TAMANO_CABECERA] = {};
+        ifstream existente(ruta, ios::binary);
+        existente.read(cabecera, TAMANO_CABECERA);
+        if (existente.gcount() != static_cast<streamsize>(TAMANO_CABECERA) ||
+            !equal(CABECERA, CABECERA + TAMANO_CABECERA, reinterpret_cast<const uint8_t*>(cabecera))) {
+            return false;
+        }
+    }
+
+    archivo.open(ruta, ios::binary | ios::app);
+    if (!archivo) {
+        return false;
+    }
+    if (vacio) {
+        buffer.insert(buffer.end(), CABECERA, CABECERA + TAMANO_CABECERA);
+    }
+    return true;
+}
+
+/**
+ * Verifica si hay archivo abierto
+ */
+bool EscritorHistorial::estaAbierto() const {
+    return archivo.is_open();
+}
+
+/**
+ * Agrega un entero en little-endian
+ */
+void EscritorHistorial::agregarEntero(uint64_t valor, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        buffer.push_back(static_cast<uint8_t>(valor >> (8 * i)));
+    }
+}
+
+/**
+ * Escribe el buffer si ya superó el límite
+ */
+void EscritorHistorial::terminarRegistro() {
+    if (buffer.size() >= LIMITE_BUFFER) {
+        vaciar();
+    }
+}
+
+/**
+ * Registro INICIO_SESION: tipo, semilla(8), barajas(1), corte(2)
+ */
+void EscritorHistorial::registrarInicioSesion(uint64_t semilla, int numBarajas, int posicionCorte) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::INICIO_SESION));
+    agregarEntero(semilla, 8);
+    agregarByte(static_cast<uint8_t>(numBarajas));
+    agregarEntero(static_cast<uint16_t>(posicionCorte), 2);
+    terminarRegistro();
+}
+
+/**
+ * Registro INICIO_RONDA: tipo, ronda(4)
+ */
+void EscritorHistorial::registrarInicioRonda(uint32_t ronda) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::INICIO_RONDA));
+    agregarEntero(ronda, 4);
+    terminarRegistro();
+}
+
+/**
+ * Registro APUESTA: tipo, asiento(1), apostador(1), centavos(8)
+ */
+void EscritorHistorial::registrarApuesta(uint8_t asiento, Centavos cantidad, uint8_t apostador) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::APUESTA));
+    agregarByte(asiento);
+    agregarByte(apostador);
+    agregarEntero(static_cast<uint64_t>(cantidad), 8);
+    terminarRegistro();
+}
+
+/**
+ * Registro SEGURO: tipo, asiento(1), apostador(1), centavos(8)
+ */
+void EscritorHistorial::registrarSeguro(uint8_t asiento, Centavos cantidad, uint8_t apostador) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::SEGURO));
+    agregarByte(asiento);
+    agregarByte(apostador);
+    agregarEntero(static_cast<uint64_t>(cantidad), 8);
+    terminarRegistro();
+}
+
+/**
+ * Registro CARTA: tipo, asiento(1), código de la carta(1)
+ */
+void EscritorHistorial::registrarCarta(uint8_t asiento, Carta carta) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::CARTA));
+    agregarByte(asiento);
+    agregarByte(carta.obtenerCodigo());
+    terminarRegistro();
+}
+
+/**
+ * Registro DECISION: tipo, asiento(1), acción(1)
+ */
+void EscritorHistorial::registrarDecision(uint8_t asiento, Accion accion) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::DECISION));
+    agregarByte(asiento);
+    agregarByte(static_cast<uint8_t>(accion));
+    terminarRegistro();
+}
+
+/**
+ * Registro LIQUIDACION: tipo, asiento(1), apostador(1), resultado(1), totales(1+1), centavos(8)
+ */
+void EscritorHistorial::registrarLiquidacion(uint8_t asiento, int resultado, int totalJugador,
+                                             int totalCrupier, Centavos retorno, uint8_t apostador) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::LIQUIDACION));
+    agregarByte(asiento);
+    agregarByte(apostador);
+    agregarByte(static_cast<uint8_t>(static_cast<int8_t>(resultado)));
+    agregarByte(static_cast<uint8_t>(totalJugador));
+    agregarByte(static_cast<uint8_t>(totalCrupier));
+    agregarEntero(static_cast<uint64_t>(retorno), 8);
+    terminarRegistro();
+}
+
+/**
+ * Registro REGLAS: tipo, opciones(1: H17, DAS y rendición en los bits 0-2),
+ * pago del Blackjack(1), límite de manos(1)
+ */
+void EscritorHistorial::registrarReglas(const ConfiguracionReglas& reglas) {
+    agregarByte(static_cast<uint8_t>(TipoEvento::REGLAS));
+    agregarByte(static_cast<uint8_t>(reglas.crupierPideSuave17 | reglas.doblarTrasDividir << 1 |
+                                     reglas.rendicionTardia << 2));
+    agregarByte(static_cast<uint8_t>(reglas.pagoBlackjack));
+    agregarByte(static_cast<uint8_t>(reglas.manosPermitidas()));
+    terminarRegistro();
+}
+
+/**
+ * Registro BARAJADO: solo el tipo
+ */
+void EscritorHistorial::registrarBarajado() {
+    agregarByte(static_cast<uint8_t>(TipoEvento::BARAJADO));
+    terminarRegistro();
+}
+
+/**
+ * Escribe el buffer al archivo
+ */
+bool EscritorHistorial::vaciar() {
+    if (!archivo.is_open()) {
+        buffer.clear();
+        return false;
+    }
+    if (!buffer.empty()) {
+        archivo.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        buffer.clear();
+    }
+    archivo.flush();
+    return static_cast<bool>(archivo);
+}
+
+/**
+ * Tamaño de cada tipo de registro, incluido el byte de tipo
+ */
+size_t EscritorHistorial::tamanoRegistro(uint8_t tipo) {
+    switch (static_cast<TipoEvento>(tipo)) {
+        case TipoEvento::INICIO_SESION: return 12;
+        case TipoEvento::INICIO_RONDA: return 5;
+        case TipoEvento::APUESTA: return 11;
+        case TipoEvento::CARTA: return 3;
+        case TipoEvento::DECISION: return 3;
+        case TipoEvento::LIQUIDACION: return 14;
+        case TipoEvento::BARAJADO: return 1;
+        case TipoEvento::SEGURO: return 11;
+        case TipoEvento::REGLAS: return 4;
+        default: return 0;
+    }
+}
+
+/**
+ * Constructor del iterador: decodifica el primer evento
+ */
+LectorHistorial::Iterador::Iterador(const uint8_t* actual, const uint8_t* fin)
+    : actual(actual), fin(fin) {
+    decodificar();
+}
+
+/**
+ * Decodifica el registro actual; si está incompleto el iterador pasa a ser
+ * el final, y si es desconocido entrega un evento DESCONOCIDO
+ */
+void LectorHistorial::Iterador::decodificar() {
+    if (actual == fin) {
+        return;
+    }
+    evento = EventoHistorial();
+    size_t tamano = EscritorHistorial::tamanoRegistro(actual[0]);
+    if (tamano == 0) {
+        evento.tipo = TipoEvento::DESCONOCIDO;
+        return;
+    }
+    if (static_cast<size_t>(fin - actual) < tamano) {
+        actual = fin;
+        return;
+    }
+
+    evento.tipo = static_cast<TipoEvento>(actual[0]);
+    const uint8_t* campos = actual + 1;
+    switch (evento.tipo) {
+        case TipoEvento::INICIO_SESION:
+            evento.semilla = leerEntero(campos, 8);
+            evento.numBarajas = campos[8];
+            evento.posicionCorte = static_cast<uint16_t>(leerEntero(campos + 9, 2));
+            break;
+        case TipoEvento::INICIO_RONDA:
+            evento.ronda = static_cast<uint32_t>(leerEntero(campos, 4));
+            break;
+        case TipoEvento::APUESTA:
+        case TipoEvento::SEGURO:
+            evento.asiento = campos[0];
+            evento.apostador = campos[1];
+            evento.centavos = static_cast<int64_t>(leerEntero(campos + 2, 8));
+            break;
+        case TipoEvento::CARTA:
+            evento.asiento = campos[0];
+            if (campos[1] != Carta::CODIGO_INVALIDO) {
+                evento.carta = Carta(campos[1] & 0x0F, (campos[1] >> 4) & 0x03);
+            }
+            break;
+        case TipoEvento::DECISION:
+            evento.asiento = campos[0];
+            evento.accion = static_cast<Accion>(campos[1]);
+            break;
+        case TipoEvento::LIQUIDACION:
+            evento.asiento = campos[0];
+            evento.apostador = campos[1];
+            evento.resultado = static_cast<int8_t>(campos[2]);
+            evento.totalJugador = campos[3];
+            evento.totalCrupier = campos[4];
+            evento.centavos = static_cast<int64_t>(leerEntero(campos + 5, 8));
+            break;
+        case TipoEvento::REGLAS:
+            // Un pago desconocido no se puede despachar: se trata como registro desconocido
+            if (campos[1] > static_cast<uint8_t>(PagoBlackjack::UNO_A_UNO)) {
+                evento = EventoHistorial();
+                evento.tipo = TipoEvento::DESCONOCIDO;
+                return;
+            }
+            evento.reglas.crupierPideSuave17 = campos[0] & 1;
+            evento.reglas.doblarTrasDividir = (campos[0] >> 1) & 1;
+            evento.reglas.rendicionTardia = (campos[0] >> 2) & 1;
+            evento.reglas.pagoBlackjack = static_cast<PagoBlackjack>(campos[1]);
+            evento.reglas.maxManos = campos[2];
+            break;
+        case TipoEvento::BARAJADO:
+        case TipoEvento::DESCONOCIDO:
+            break;
+    }
+}
+
+/**
+ * Avanza al siguiente registro
+ */
+LectorHistorial::Iterador& LectorHistorial::Iterador::operator++() {
+    if (actual != fin) {
+        // Tras un registro desconocido no se sabe dónde empieza el siguiente
+        actual = evento.tipo == TipoEvento::DESCONOCIDO ? fin : actual + EscritorHistorial::tamanoRegistro(actual[0]);
+        decodificar();
+    }
+    return *this;
+}
+
+/**
+ * Constructor sin archivo
+ */
+LectorHistorial::LectorHistorial() : datos(nullptr), tamano(0) {}
+
+/**
+ * Destructor que libera la proyección
+ */
+LectorHistorial::~LectorHistorial() {
+    cerrar();
+}
+
+/**
+ * Proyecta el archivo en memoria de solo lectura y valida la cabecera
+ */
+bool LectorHistorial::abrir(const string& ruta) {
+    cerrar();
+
+    int descriptor = open(ruta.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat informacion;
+    if (fstat(descriptor, &informacion) != 0 ||
+        informacion.st_size < static_cast<off_t>(EscritorHistorial::TAMANO_CABECERA)) {
+        close(descriptor);
+        return false;
+    }
+
+    size_t bytes = static_cast<size_t>(informacion.st_size);
+    void* proyeccion = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);  // La proyección sigue válida sin el descriptor
+    if (proyeccion == MAP_FAILED) {
+        return false;
+    }
+
+    datos = static_cast<const uint8_t*>(proyeccion);
+    tamano = bytes;
+    if (!equal(CABECERA, CABECERA + EscritorHistorial::TAMANO_CABECERA, datos)) {
+        cerrar();
+        return false;
+    }
+    madvise(const_cast<uint8_t*>(datos), tamano, MADV_SEQUENTIAL);
+    return true;
+}
+
+/**
+ * Libera la proyección
+ */
+void LectorHistorial::cerrar() {
+    if (datos != nullptr) {
+        munmap(const_cast<uint8_t*>(datos), tamano);
+    }
+    datos = nullptr;
+    tamano = 0;
+}
+
+/**
+ * Iterador al primer evento, después de la cabecera
+ */
+LectorHistorial::Iterador LectorHistorial::begin() const {
+    if (datos == nullptr) {
+        return end();
+    }
+    return Iterador(datos + EscritorHistorial::TAMANO_CABECERA, datos + tamano);
+}
+
+/**
+ * Iterador al final del archivo
+ */
+LectorHistorial::Iterador LectorHistorial::end() const {
+    return Iterador(datos + tamano, datos + tamano);
+}
+
+/**
+ * Getter del tamaño del archivo
+ */
+size_t LectorHistorial::tamanoBytes() const {
+    return tamano;
+}
@@ -0,0 +1,266 @@
+#ifndef HISTORIAL_BINARIO_H
+#define HISTORIAL_BINARIO_H
+
+#include "Carta.h"
+#include "ConjuntoReglas.h"
+#include "Dinero.h"
+#include "EstrategiaBasica.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * @enum TipoEvento
+ * @brief Tipos de registro del historial binario
+ */
+enum class TipoEvento : uint8_t {
+    DESCONOCIDO = 0,    ///< Solo al leer: registro que esta versión no sabe decodificar
+    INICIO_SESION,      ///< Semilla, barajas y carta de corte del zapato
+    INICIO_RONDA,       ///< Número de ronda
+    APUESTA,            ///< Asiento, apostador y cantidad apostada
+    CARTA,              ///< Asiento y carta repartida (1 byte)
+    DECISION,           ///< Asiento y acción elegida
+    LIQUIDACION,        ///< Asiento, apostador, resultado, totales y retorno
+    BARAJADO,           ///< El zapato se barajó
+    SEGURO,             ///< Asiento, apostador y seguro tomado
+    REGLAS              ///< Variante de reglas de la mesa desde este punto
+};
+
+/**
+ * @struct EventoHistorial
+ * @brief Evento decodificado del historial
+ *
+ * Solo son significativos los campos del tipo de evento; los demás quedan
+ * en cero. Las cantidades se guardan en centavos.
+ */
+struct EventoHistorial {
+    static constexpr uint8_t ASIENTO_CRUPIER = 0xFF;  ///< Asiento que identifica al crupier
+
+    TipoEvento tipo = TipoEvento::INICIO_RONDA;
+    uint8_t asiento = 0;          ///< APUESTA, CARTA, DECISION, LIQUIDACION, SEGURO
+    uint8_t apostador = 0;        ///< APUESTA, LIQUIDACION, SEGURO: 0 el titular, k quien apuesta detrás
+    uint64_t semilla = 0;         ///< INICIO_SESION
+    uint8_t numBarajas = 0;       ///< INICIO_SESION
+    uint16_t posicionCorte = 0;   ///< INICIO_SESION
+    uint32_t ronda = 0;           ///< INICIO_RONDA
+    int64_t centavos = 0;         ///< APUESTA: apuesta; LIQUIDACION: retorno total; SEGURO: seguro
+    Carta carta;                  ///< CARTA
+    Accion accion = Accion::PLANTARSE;  ///< DECISION
+    int8_t resultado = 0;         ///< LIQUIDACION: 1 gana, 0 empate, -1 pierde, -2 se rinde
+    uint8_t totalJugador = 0;     ///< LIQUIDACION
+    uint8_t totalCrupier = 0;     ///< LIQUIDACION
+    ConfiguracionReglas reglas;   ///< REGLAS (sin el número de barajas, que va en INICIO_SESION)
+};
+
+/**
+ * @class EscritorHistorial
+ * @brief Escribe el historial de juego como registros binarios compactos
+ *
+ * El archivo empieza con una cabecera de 4 bytes ("BJH" y la versión) y
+ * después contiene registros de tamaño fijo por tipo: un byte de tipo y
+ * los campos en little-endian (una carta ocupa 3 bytes en total). Solo se
+ * agregan registros al final; los eventos se acumulan en memoria y se
+ * escriben al llamar a vaciar() o cuando el buffer se llena.
+ */
+class EscritorHistorial {
+private:
+    ofstream archivo;         ///< Archivo abierto en modo de agregado
+    vector<uint8_t> buffer;   ///< Registros pendientes de escribir
+
+    void agregarByte(uint8_t valor) { buffer.push_back(valor); }
+    void agregarEntero(uint64_t valor, int bytes);
+    void terminarRegistro();
+
+public:
+    /// Versión del formato; cambia con cada registro nuevo o de otro significado
+    /// (2: SEGURO y una LIQUIDACION por mano; 3: REGLAS; 4: apostador en
+    /// APUESTA, SEGURO y LIQUIDACION)
+    static constexpr uint8_t VERSION = 4;
+    static constexpr size_t TAMANO_CABECERA = 4;    ///< "BJH" + versión
+
+    /**
+     * @brief Constructor de la clase EscritorHistorial
+     * @post No hay archivo abierto
+     */
+    EscritorHistorial();
+
+    /**
+     * @brief Destructor; escribe los eventos pendientes
+     */
+    ~EscritorHistorial();
+
+    /**
+     * @brief Abre un historial para agregar eventos
+     * @param ruta Ruta del archivo
+     * @return true si el archivo se abrió; false si no se pudo abrir o si
+     *         tiene datos y no empieza con la cabecera de esta versión
+     * @post Si el archivo no existía o estaba vacío se escribe la cabecera;
+     *       si se rechaza, el archivo no cambia
+     */
+    bool abrir(const string& ruta);
+
+    /**
+     * @brief Verifica si hay un archivo abierto
+     * @return true si se pueden registrar eventos
+     */
+    bool estaAbierto() const;
+
+    /**
+     * @brief Registra el inicio de una sesión (12 bytes)
+     * @param semilla Semilla del zapato
+     * @param numBarajas Barajas del zapato
+     * @param posicionCorte Índice de la carta de corte
+     */
+    void registrarInicioSesion(uint64_t semilla, int numBarajas, int posicionCorte);
+
+    /**
+     * @brief Registra el inicio de una ronda (5 bytes)
+     * @param ronda Número de ronda
+     */
+    void registrarInicioRonda(uint32_t ronda);
+
+    /**
+     * @brief Registra una apuesta (11 bytes)
+     * @param asiento Asiento de la mano a la que se apuesta
+     * @param cantidad Cantidad apostada en centavos
+     * @param apostador 0 para el titular, k para el k-ésimo que apuesta detrás
+     */
+    void registrarApuesta(uint8_t asiento, Centavos cantidad, uint8_t apostador = 0);
+
+    /**
+     * @brief Registra una carta repartida (3 bytes)
+     * @param asiento Asiento que recibe la carta (ASIENTO_CRUPIER para el crupier)
+     * @param carta Carta repartida
+     */
+    void registrarCarta(uint8_t asiento, Carta carta);
+
+    /**
+     * @brief Registra el seguro de una posición (11 bytes)
+     * @param asiento Asiento de la mano asegurada
+     * @param cantidad Seguro en centavos
+     * @param apostador 0 para el titular, k para el k-ésimo que apuesta detrás
+     */
+    void registrarSeguro(uint8_t asiento, Centavos cantidad, uint8_t apostador = 0);
+
+    /**
+     * @brief Registra la decisión de un jugador (3 bytes)
+     * @param asiento Asiento del jugador
+     * @param accion Acción elegida
+     */
+    void registrarDecision(uint8_t asiento, Accion accion);
+
+    /**
+     * @brief Registra la liquidación de una mano (14 bytes)
+     * @param asiento Asiento de la mano
+     * @param resultado 1 gana, 0 empate, -1 pierde, -2 se rinde
+     * @param totalJugador Total final de la mano
+     * @param totalCrupier Total final del crupier
+     * @param retorno Cantidad total devuelta al apostador, en centavos
+     * @param apostador 0 para el titular (una liquidación por mano), k para
+     *        el k-ésimo que apuesta detrás (sigue la primera mano)
+     */
+    void registrarLiquidacion(uint8_t asiento, int resultado, int totalJugador,
+                              int totalCrupier, Centavos retorno, uint8_t apostador = 0);
+
+    /**
+     * @brief Registra la variante de reglas de la mesa (4 bytes)
+     * @param reglas Reglas vigentes: H17, doblar tras dividir, rendición, pago y límite de manos
+     */
+    void registrarReglas(const ConfiguracionReglas& reglas);
+
+    /**
+     * @brief Registra que el zapato se barajó (1 byte)
+     */
+    void registrarBarajado();
+
+    /**
+     * @brief Escribe en el archivo los eventos pendientes
+     * @return true si la escritura fue correcta
+     */
+    bool vaciar();
+
+    /**
+     * @brief Tamaño en bytes del registro de un tipo de evento
+     * @param tipo Tipo de evento
+     * @return Bytes del registro incluyendo el byte de tipo, 0 si el tipo no existe
+     */
+    static size_t tamanoRegistro(uint8_t tipo);
+};
+
+/**
+ * @class LectorHistorial
+ * @brief Lee un historial binario proyectándolo en memoria (mmap)
+ *
+ * Los eventos se decodifican al avanzar el iterador, directamente desde
+ * el archivo proyectado, sin reservar memoria por evento. Un registro
+ * desconocido se entrega como un evento DESCONOCIDO, para que quien lee lo
+ * rechace, y termina la lectura; un registro incompleto al final (una
+ * escritura interrumpida) la termina sin evento.
+ */
+class LectorHistorial {
+private:
+    const uint8_t* datos;  ///< Inicio de la proyección del archivo
+    size_t tamano;         ///< Tamaño del archivo en bytes
+
+public:
+    /**
+     * @class Iterador
+     * @brief Recorre los eventos del historial en orden
+     */
+    class Iterador {
+    private:
+        const uint8_t* actual;
+        const uint8_t* fin;
+        EventoHistorial evento;
+
+        void decodificar();
+
+    public:
+        Iterador(const uint8_t* actual, const uint8_t* fin);
+        const EventoHistorial& operator*() const { return evento; }
+        const EventoHistorial* operator->() const { return &evento; }
+        Iterador& operator++();
+        bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+        bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+    };
+
+    /**
+     * @brief Constructor de la clase LectorHistorial
+     * @post No hay archivo abierto
+     */
+    LectorHistorial();
+
+    /**
+     * @brief Destructor; libera la proyección
+     */
+    ~LectorHistorial();
+
+    LectorHistorial(const LectorHistorial&) = delete;
+    LectorHistorial& operator=(const LectorHistorial&) = delete;
+
+    /**
+     * @brief Proyecta un historial en memoria
+     * @param ruta Ruta del archivo
+     * @return true si el archivo existe y tiene una cabecera válida
+     */
+    bool abrir(const string& ruta);
+
+    /**
+     * @brief Libera la proyección actual
+     */
+    void cerrar();
+
+    Iterador begin() const;
+    Iterador end() const;
+
+    /**
+     * @brief Obtiene el tamaño del historial
+     * @return Bytes del archivo, 0 si no hay archivo abierto
+     */
+    size_t tamanoBytes() const;
+};
+
+#endif // HISTORIAL_BINARIO_H
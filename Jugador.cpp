@@ -5,21 +5,21 @@ using namespace std;
 /**
  * Constructor que inicializa un jugador con nombre y dinero inicial
  */
-Jugador::Jugador(const string& nombre, double dineroInicial) 
-    : nombre(nombre), dinero(dineroInicial), apuestaActual(0.0) {}
+Jugador::Jugador(const string& nombre, Centavos dineroInicial) 
+    : nombre(nombre), dinero(dineroInicial), apuestaActual(0), salida(&SalidaJuego::consola()) {}
 
 /**
  * Recibe una carta y la agrega a la mano
  */
-void Jugador::recibirCarta(shared_ptr<Carta> carta) {
+void Jugador::recibirCarta(Carta carta) {
     mano.agregarCarta(carta);
 }
 
 /**
  * Realiza una apuesta si es válida
  */
-bool Jugador::apostar(double cantidad) {
-    if (cantidad > 0 && cantidad <= dinero) {
+bool Jugador::apostar(Centavos cantidad) {
+    if (puedeApostar(cantidad)) {
         dinero -= cantidad;
         apuestaActual = cantidad;
         return true;
@@ -28,10 +28,10 @@ bool Jugador::apostar(double cantidad) {
 }
 
 /**
- * Gana dinero de una apuesta
+ * Gana dinero de una apuesta, con suma verificada
  */
-void Jugador::ganar(double cantidad) {
-    dinero += cantidad;
+bool Jugador::ganar(Centavos cantidad) {
+    return Dinero::sumar(dinero, cantidad, dinero);
 }
 
 /**
@@ -42,12 +42,19 @@ bool Jugador::quiereOtraCarta() const {
     return false;  // Implementación por defecto
 }
 
+/**
+ * Setter de la salida del jugador
+ */
+void Jugador::establecerSalida(SalidaJuego* salida) {
+    this->salida = salida;
+}
+
 /**
  * Reinicia la mano para una nueva ronda
  */
 void Jugador::reiniciarMano() {
     mano.limpiar();
-    apuestaActual = 0.0;
+    apuestaActual = 0;
 }
 
 /**
@@ -74,22 +81,22 @@ const Mano& Jugador::obtenerMano() const {
 /**
  * Getter para el dinero del jugador
  */
-double Jugador::obtenerDinero() const {
+Centavos Jugador::obtenerDinero() const {
     return dinero;
 }
 
 /**
  * Getter para la apuesta actual
  */
-double Jugador::obtenerApuestaActual() const {
+Centavos Jugador::obtenerApuestaActual() const {
     return apuestaActual;
 }
 
 /**
  * Verifica si el jugador puede realizar una apuesta
  */
-bool Jugador::puedeApostar(double cantidad) const {
-    return cantidad > 0 && cantidad <= dinero;
+bool Jugador::puedeApostar(Centavos cantidad) const {
+    return cantidad > 0 && cantidad <= dinero && cantidad <= Dinero::APUESTA_MAXIMA;
 }
 
 /**
@@ -97,9 +104,9 @@ bool Jugador::puedeApostar(double cantidad) const {
  */
 string Jugador::obtenerInfo() const {
     stringstream ss;
-    ss << "Jugador: " << nombre << " | Dinero: $" << dinero;
+    ss << "Jugador: " << nombre << " | Dinero: $" << Dinero::formatear(dinero);
     if (apuestaActual > 0) {
-        ss << " | Apuesta actual: $" << apuestaActual;
+        ss << " | Apuesta actual: $" << Dinero::formatear(apuestaActual);
     }
     return ss.str();
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #ifndef JUGADOR_H
 #define JUGADOR_H
 
+#include "Dinero.h"
 #include "Mano.h"
+#include "SalidaJuego.h"
 #include <string>
 using namespace std;
 
@@ -17,17 +19,18 @@ class Jugador {
 protected:
     string nombre;           ///< Nombre del jugador
     Mano mano;              ///< Mano de cartas del jugador
-    double dinero;          ///< Dinero disponible del jugador
-    double apuestaActual;   ///< Apuesta actual del jugador
+    Centavos dinero;        ///< Dinero disponible del jugador
+    Centavos apuestaActual; ///< Apuesta actual del jugador
+    SalidaJuego* salida;    ///< Destino del texto que muestra el jugador (no se posee)
 
 public:
     /**
      * @brief Constructor de la clase Jugador
      * @param nombre Nombre del jugador
-     * @param dineroInicial Dinero inicial del jugador
+     * @param dineroInicial Dinero inicial del jugador, en centavos
      * @post Crea un jugador con el nombre y dinero especificados
      */
-    Jugador(const string& nombre, double dineroInicial = 1000.0);
+    Jugador(const string& nombre, Centavos dineroInicial = Dinero::desdeDolares(1000));
 
     /**
      * @brief Destructor virtual para permitir herencia
@@ -36,27 +39,29 @@ public:
 
     /**
      * @brief Recibe una carta y la agrega a la mano
-     * @param carta Puntero compartido a la carta recibida
-     * @pre carta no debe ser nullptr
+     * @param carta Carta recibida
+     * @pre carta debe ser válida
      * @post La carta se agrega a la mano del jugador
      */
-    void recibirCarta(shared_ptr<Carta> carta);
+    void recibirCarta(Carta carta);
 
     /**
      * @brief Realiza una apuesta
-     * @param cantidad Cantidad a apostar
+     * @param cantidad Cantidad a apostar, en centavos
      * @return true si la apuesta es válida, false en caso contrario
-     * @pre cantidad debe ser positiva y menor o igual al dinero disponible
+     * @pre cantidad debe ser positiva, menor o igual al dinero disponible y a
+     *      Dinero::APUESTA_MAXIMA
      * @post Si es válida, se descuenta del dinero y se establece como apuesta actual
      */
-    bool apostar(double cantidad);
+    bool apostar(Centavos cantidad);
 
     /**
      * @brief Gana dinero por una apuesta
-     * @param cantidad Cantidad ganada
+     * @param cantidad Cantidad ganada, en centavos
+     * @return false si el saldo desbordaría; en ese caso no cambia
      * @post El dinero se suma al total del jugador
      */
-    void ganar(double cantidad);
+    bool ganar(Centavos cantidad);
 
     /**
      * @brief Decide si quiere otra carta (implementación virtual)
@@ -64,6 +69,13 @@ public:
      */
     virtual bool quiereOtraCarta() const;
 
+    /**
+     * @brief Asigna el destino del texto que muestra el jugador
+     * @param salida Salida a usar
+     * @pre salida no debe ser nullptr y debe vivir más que el jugador
+     */
+    void establecerSalida(SalidaJuego* salida);
+
     /**
      * @brief Reinicia la mano para una nueva ronda
      * @post La mano se limpia y la apuesta actual se reinicia
@@ -74,15 +86,15 @@ public:
     string obtenerNombre() const;
     Mano& obtenerMano();
     const Mano& obtenerMano() const;
-    double obtenerDinero() const;
-    double obtenerApuestaActual() const;
+    Centavos obtenerDinero() const;
+    Centavos obtenerApuestaActual() const;
 
     /**
      * @brief Verifica si el jugador puede apostar una cantidad
-     * @param cantidad Cantidad a verificar
+     * @param cantidad Cantidad a verificar, en centavos
      * @return true si puede apostar esa cantidad, false en caso contrario
      */
-    bool puedeApostar(double cantidad) const;
+    bool puedeApostar(Centavos cantidad) const;
 
     /**
      * @brief Obtiene información del jugador
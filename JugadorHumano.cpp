@@ -1,12 +1,12 @@
 #include "JugadorHumano.h"
 #include <iostream>
-#include <limits>
+#include <sstream>
 using namespace std;
 
 /**
  * Constructor que inicializa un jugador humano
  */
-JugadorHumano::JugadorHumano(const string& nombre, double dineroInicial) 
+JugadorHumano::JugadorHumano(const string& nombre, Centavos dineroInicial) 
     : Jugador(nombre, dineroInicial) {}
 
 /**
@@ -14,60 +14,110 @@ JugadorHumano::JugadorHumano(const string& nombre, double dineroInicial)
  * Interactúa con el usuario a través de la consola
  */
 bool JugadorHumano::quiereOtraCarta() const {
-    char respuesta;
-    cout << "\n" << nombre << ", tu mano actual:" << endl;
-    cout << mano.toString() << endl;
-
-    // Verificar si ya se pasó
-    if (mano.sePaso()) {
-        cout << "¡Te pasaste de 21!" << endl;
+    if (!preguntarOtraCarta()) {
         return false;
     }
 
-    cout << "¿Quieres otra carta? (s/n): ";
-    cin >> respuesta;
+    string linea;
+    getline(cin, linea);
+    return interpretarRespuesta(linea);
+}
 
-    // Limpiar buffer de entrada
-    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+/**
+ * Solicita al jugador que realice una apuesta
+ */
+Centavos JugadorHumano::solicitarApuesta() const {
+    Centavos cantidad = 0;
+    string linea;
 
-    return (respuesta == 's' || respuesta == 'S');
+    preguntarApuesta();
+    while (getline(cin, linea) && !interpretarApuesta(linea, cantidad)) {}
+    return cin ? cantidad : 0;
 }
 
 /**
- * Solicita al jugador que realice una apuesta
+ * Muestra la mano actual del jugador
  */
-double JugadorHumano::solicitarApuesta() const {
-    double cantidad;
+void JugadorHumano::mostrarMano() const {
+    *salida << "\n" << nombre << " - " << mano.toString() << '\n';
+}
 
-    cout << "\n" << obtenerInfo() << endl;
-    cout << "¿Cuánto quieres apostar? (0 para no apostar): $";
+/**
+ * Muestra la mano y la pregunta; si ya se pasó no hay nada que preguntar
+ */
+bool JugadorHumano::preguntarOtraCarta() const {
+    *salida << "\n" << nombre << ", tu mano actual:\n";
+    *salida << mano.toString() << '\n';
 
-    while (!(cin >> cantidad)) {
-        cout << "Por favor ingresa un número válido: $";
-        cin.clear();
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    // Verificar si ya se pasó
+    if (mano.sePaso()) {
+        *salida << "¡Te pasaste de 21!\n";
+        return false;
     }
 
-    // Limpiar buffer de entrada
-    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    *salida << "¿Quieres otra carta? (s/n): ";
+    salida->flush();
+    return true;
+}
 
-    // Validar que la cantidad sea válida
-    if (cantidad < 0) {
-        cout << "La cantidad no puede ser negativa." << endl;
-        return 0;
-    }
+/**
+ * Solo cuenta el primer carácter no blanco
+ */
+bool JugadorHumano::interpretarRespuesta(const string& linea) {
+    char respuesta = 'n';
+    stringstream(linea) >> respuesta;
+    return (respuesta == 's' || respuesta == 'S');
+}
 
-    if (cantidad > dinero) {
-        cout << "No tienes suficiente dinero. Máximo: $" << dinero << endl;
-        return 0;
+/**
+ * Primera letra de la línea; sin letra reconocida el jugador se planta
+ */
+Accion JugadorHumano::interpretarDecision(const string& linea) {
+    char respuesta = 'n';
+    stringstream(linea) >> respuesta;
+    switch (respuesta) {
+        case 's': case 'S': return Accion::PEDIR;
+        case 'd': case 'D': return Accion::DOBLAR;
+        case 'v': case 'V': return Accion::DIVIDIR;
+        case 'r': case 'R': return Accion::RENDIRSE;
+        default: return Accion::PLANTARSE;
     }
+}
 
-    return cantidad;
+/**
+ * Muestra la información del jugador y la pregunta de la apuesta
+ */
+void JugadorHumano::preguntarApuesta() const {
+    *salida << "\n" << obtenerInfo() << '\n';
+    *salida << "¿Cuánto quieres apostar? (0 para no apostar): $";
+    salida->flush();
 }
 
 /**
- * Muestra la mano actual del jugador
+ * Valida la apuesta contra el dinero del jugador
  */
-void JugadorHumano::mostrarMano() const {
-    cout << "\n" << nombre << " - " << mano.toString() << endl;
-}
\ No newline at end of file
+bool JugadorHumano::interpretarApuesta(const string& linea, Centavos& cantidad) const {
+    return interpretarApuesta(linea, dinero, *salida, cantidad);
+}
+
+/**
+ * Valida la apuesta; los valores fuera de rango se convierten en "no apostar"
+ */
+bool JugadorHumano::interpretarApuesta(const string& linea, Centavos dineroDisponible, ostream& salida,
+                                       Centavos& cantidad) {
+    if (!Dinero::desdeTexto(linea, cantidad)) {
+        salida << "Por favor ingresa un número válido: $";
+        salida.flush();
+        return false;
+    }
+
+    // Validar que la cantidad sea válida
+    if (cantidad < 0) {
+        salida << "La cantidad no puede ser negativa.\n";
+        cantidad = 0;
+    } else if (cantidad > dineroDisponible) {
+        salida << "No tienes suficiente dinero. Máximo: $" << Dinero::formatear(dineroDisponible) << '\n';
+        cantidad = 0;
+    }
+    return true;
+}
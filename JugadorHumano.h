@@ -1,6 +1,7 @@
 #ifndef JUGADOR_HUMANO_H
 #define JUGADOR_HUMANO_H
 
+#include "EstrategiaBasica.h"
 #include "Jugador.h"
 using namespace std;
 
@@ -20,7 +21,7 @@ public:
      * @param dineroInicial Dinero inicial del jugador
      * @post Crea un jugador humano con el nombre y dinero especificados
      */
-    JugadorHumano(const string& nombre, double dineroInicial = 1000.0);
+    JugadorHumano(const string& nombre, Centavos dineroInicial = Dinero::desdeDolares(1000));
 
     /**
      * @brief Destructor de la clase JugadorHumano
@@ -39,13 +40,58 @@ public:
      * @return Cantidad apostada (0 si no quiere apostar)
      * @post Muestra información del jugador y solicita apuesta
      */
-    double solicitarApuesta() const;
+    Centavos solicitarApuesta() const;
 
     /**
      * @brief Muestra la mano actual del jugador
      * @post Imprime la mano y el valor total en consola
      */
     void mostrarMano() const;
+
+    /**
+     * @brief Muestra la mano y pregunta si quiere otra carta, sin leer la respuesta
+     * @return false si la mano ya se pasó y no hace falta preguntar
+     */
+    bool preguntarOtraCarta() const;
+
+    /**
+     * @brief Interpreta la respuesta a "¿Quieres otra carta?"
+     * @param linea Línea escrita por el jugador
+     * @return true si la respuesta empieza por 's' o 'S'
+     */
+    static bool interpretarRespuesta(const string& linea);
+
+    /**
+     * @brief Interpreta la decisión sobre una mano
+     * @param linea Línea escrita por el jugador
+     * @return PEDIR con 's', DOBLAR con 'd', DIVIDIR con 'v', RENDIRSE con 'r'
+     *         (en mayúscula o minúscula) y PLANTARSE con cualquier otra cosa
+     */
+    static Accion interpretarDecision(const string& linea);
+
+    /**
+     * @brief Muestra la información del jugador y pide la apuesta, sin leerla
+     */
+    void preguntarApuesta() const;
+
+    /**
+     * @brief Interpreta y valida una apuesta escrita por el jugador
+     * @param linea Línea escrita por el jugador
+     * @param cantidad Apuesta resultante en centavos (0 si es negativa o excede el dinero)
+     * @return false si la línea no es una cantidad; se vuelve a pedir
+     */
+    bool interpretarApuesta(const string& linea, Centavos& cantidad) const;
+
+    /**
+     * @brief Interpreta y valida una apuesta contra un dinero disponible
+     * @param linea Línea escrita por el jugador
+     * @param dineroDisponible Máximo que se puede apostar, en centavos
+     * @param salida Donde se muestran los avisos
+     * @param cantidad Apuesta resultante en centavos (0 si es negativa o excede el dinero)
+     * @return false si la línea no es una cantidad con a lo sumo dos decimales; se vuelve a pedir
+     */
+    static bool interpretarApuesta(const string& linea, Centavos dineroDisponible, ostream& salida,
+                                   Centavos& cantidad);
 };
 
 #endif // JUGADOR_HUMANO_H
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "Liquidacion.h"
+#include "Reglas.h"
+using namespace std;
+
+namespace {
+    // Retorno entero por unidad apostada, indexado por resultado + 2; el
+    // Blackjack y la rendición suman aparte su parte proporcional
+    const Centavos FACTORES_RETORNO[5] = {
+        0,  // RINDE
+        0,  // PIERDE
+        1,  // EMPATE
+        2,  // GANA
+        1   // GANA_BLACKJACK
+    };
+
+    // El seguro paga 2:1: se devuelve el seguro y dos veces su importe
+    constexpr Centavos FACTOR_SEGURO = 3;
+}
+
+/**
+ * Factor entero más el pago de Blackjack o la media apuesta de la
+ * rendición, ambos redondeados hacia abajo al centavo; con la apuesta
+ * acotada por Dinero::APUESTA_MAXIMA ningún producto desborda
+ */
+Centavos Liquidacion::retornoDe(int8_t resultado, Centavos apuesta, int64_t numerador, int64_t denominador) {
+    Centavos pagoBlackjack = apuesta * numerador / denominador;
+    return apuesta * FACTORES_RETORNO[resultado + 2] + (resultado == GANA_BLACKJACK) * pagoBlackjack +
+           (resultado == RINDE) * (apuesta / 2);
+}
+
+/**
+ * Mismo orden de reglas que Reglas::compararManos, escrito con selecciones
+ * en lugar de ramas para que el bucle se pueda vectorizar
+ */
+void Liquidacion::resolverAsientos(const uint8_t* totales, const EstadoAsiento* estados, size_t numAsientos,
+                                   int totalCrupier, bool blackjackCrupier, int8_t* resultados) {
+    const int crupierPasado = totalCrupier > 21;
+    const int bjCrupier = blackjackCrupier;
+    for (size_t i = 0; i < numAsientos; i++) {
+        int total = totales[i];
+        EstadoAsiento estado = estados[i];
+        int bjJugador = estado == EstadoAsiento::BLACKJACK;
+        int conMano = estado == EstadoAsiento::PLANTADO || estado == EstadoAsiento::JUGANDO || bjJugador;
+        int rendido = estado == EstadoAsiento::RENDIDO;
+
+        int resultado = crupierPasado ? 1 : (total > totalCrupier) - (total < totalCrupier);
+        resultado = (bjJugador | bjCrupier) ? bjJugador - bjCrupier : resultado;
+        resultado += bjJugador & (resultado > 0);   // GANA -> GANA_BLACKJACK
+        resultado = conMano ? resultado : PIERDE;
+        resultados[i] = static_cast<int8_t>(rendido ? RINDE : resultado);
+    }
+}
+
+/**
+ * Cada posición copia el resultado de su asiento y multiplica su apuesta
+ * por el factor de ese resultado. El pago de Blackjack se redondea hacia
+ * abajo igual que ConjuntoReglas::calcularPagoBlackjack
+ */
+void Liquidacion::calcularRetornos(const int8_t* resultadosAsiento, const uint8_t* asientosPosicion,
+                                   const Centavos* apuestas, size_t numPosiciones,
+                                   int8_t* resultados, Centavos* retornos,
+                                   int64_t numerador, int64_t denominador) {
+    for (size_t i = 0; i < numPosiciones; i++) {
+        int8_t resultado = resultadosAsiento[asientosPosicion[i]];
+        resultados[i] = resultado;
+        retornos[i] = retornoDe(resultado, apuestas[i], numerador, denominador);
+    }
+}
+
+/**
+ * Guarda la proporción del pago del Blackjack
+ */
+void Liquidacion::establecerReglas(const ConfiguracionReglas& reglas) {
+    numeradorBlackjack = reglas.numeradorBlackjack();
+    denominadorBlackjack = reglas.denominadorBlackjack();
+}
+
+/**
+ * Liquida la mesa completa: manos, posiciones, manos divididas y seguros
+ * Cada mano cabe en 64 bits por el máximo de apuesta, pero la suma de las
+ * manos divididas y el seguro de una posición se verifica
+ */
+bool Liquidacion::liquidar(const Asientos& asientos, const Mano& manoCrupier) {
+    size_t numAsientos = static_cast<size_t>(asientos.numAsientos());
+    size_t numManos = static_cast<size_t>(asientos.numManosEnUso());
+    size_t numPosiciones = static_cast<size_t>(asientos.numPosiciones());
+    resultadosMano.resize(numManos);
+    resultados.resize(numPosiciones);
+    retornos.resize(numPosiciones);
+    desbordados.assign(numPosiciones, 0);
+
+    bool blackjackCrupier = manoCrupier.esBlackjack();
+    resolverAsientos(asientos.obtenerTotales().data(), asientos.obtenerEstados().data(), numManos,
+                     manoCrupier.calcularValor(), blackjackCrupier, resultadosMano.data());
+    calcularRetornos(resultadosMano.data(), asientos.obtenerAsientosPosicion().data(),
+                     asientos.obtenerApuestas().data(), numPosiciones, resultados.data(), retornos.data(),
+                     numeradorBlackjack, denominadorBlackjack);
+
+    // Las manos divididas solo son del titular
+    const vector<uint8_t>& asientosMano = asientos.obtenerAsientosMano();
+    const vector<Centavos>& apuestasMano = asientos.obtenerApuestasMano();
+    for (size_t hueco = numAsientos; hueco < numManos; hueco++) {
+        size_t titular = static_cast<size_t>(asientos.obtenerTitular(asientosMano[hueco]));
+        Centavos retornoMano = retornoDe(resultadosMano[hueco], apuestasMano[hueco],
+                                         numeradorBlackjack, denominadorBlackjack);
+        desbordados[titular] |= !Dinero::sumar(retornos[titular], retornoMano, retornos[titular]);
+    }
+
+    const vector<Centavos>& seguros = asientos.obtenerSeguros();
+    for (size_t i = 0; i < numPosiciones; i++) {
+        Centavos pagoSeguro;
+        desbordados[i] |= !Dinero::aplicarProporcion(seguros[i], FACTOR_SEGURO * blackjackCrupier, 1, pagoSeguro) ||
+                          !Dinero::sumar(retornos[i], pagoSeguro, retornos[i]);
+    }
+
+    // Un retorno que no se puede representar no se paga
+    bool correcto = true;
+    for (size_t i = 0; i < numPosiciones; i++) {
+        retornos[i] = desbordados[i] ? 0 : retornos[i];
+        correcto &= !desbordados[i];
+    }
+    return correcto;
+}
+
+/**
+ * Getter de los resultados
+ */
+const vector<int8_t>& Liquidacion::obtenerResultados() const {
+    return resultados;
+}
+
+/**
+ * Getter de los resultados por mano
+ */
+const vector<int8_t>& Liquidacion::obtenerResultadosMano() const {
+    return resultadosMano;
+}
+
+/**
+ * Getter de los retornos
+ */
+const vector<Centavos>& Liquidacion::obtenerRetornos() const {
+    return retornos;
+}
+
+/**
+ * Getter de las posiciones desbordadas
+ */
+const vector<uint8_t>& Liquidacion::obtenerDesbordados() const {
+    return desbordados;
+}
@@ -0,0 +1,133 @@
+#ifndef LIQUIDACION_H
+#define LIQUIDACION_H
+
+#include "Asientos.h"
+#include "ConjuntoReglas.h"
+#include "Dinero.h"
+#include "Mano.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+/**
+ * @class Liquidacion
+ * @brief Liquidación por lotes de todas las apuestas de una mesa
+ *
+ * La liquidación se hace en recorridos sin ramas sobre arreglos
+ * contiguos: primero se resuelve cada mano contra el estado final del
+ * crupier, y luego cada posición toma el resultado de la primera mano de su
+ * asiento y calcula su retorno en centavos con una tabla de factores
+ * enteros. Las manos divididas de la reserva de Asientos suman su retorno
+ * al titular, y los seguros se pagan 2:1 si el crupier tiene Blackjack.
+ * El Blackjack se paga con la proporción de la mesa (3:2 por defecto).
+ * Mostrar los resultados es un paso aparte de quien llama.
+ *
+ * Códigos de resultado: RINDE (-2), PIERDE (-1), EMPATE (0), GANA (1) y
+ * GANA_BLACKJACK (2). Salvo RINDE coinciden en signo con Reglas::compararManos.
+ */
+class Liquidacion {
+public:
+    static constexpr int8_t RINDE = -2;           ///< Se devuelve media apuesta
+    static constexpr int8_t PIERDE = -1;          ///< Se pierde la apuesta
+    static constexpr int8_t EMPATE = 0;           ///< Se devuelve la apuesta
+    static constexpr int8_t GANA = 1;             ///< Se paga 1:1
+    static constexpr int8_t GANA_BLACKJACK = 2;   ///< Se paga según la mesa (3:2 por defecto)
+
+private:
+    vector<int8_t> resultadosMano;      ///< Resultado de cada mano en uso
+    vector<int8_t> resultados;          ///< Resultado de cada posición en la primera mano de su asiento
+    vector<Centavos> retornos;          ///< Retorno de cada posición (apuesta incluida)
+    vector<uint8_t> desbordados;        ///< 1 si el retorno de la posición no cabe en 64 bits
+    int64_t numeradorBlackjack = Reglas::PAGO_BLACKJACK_NUMERADOR;      ///< Pago del Blackjack de la mesa
+    int64_t denominadorBlackjack = Reglas::PAGO_BLACKJACK_DENOMINADOR;
+
+public:
+    /**
+     * @brief Calcula el retorno de una apuesta según su resultado
+     * @param resultado Código de resultado
+     * @param apuesta Apuesta en centavos
+     * @param numerador Numerador del pago del Blackjack
+     * @param denominador Denominador del pago del Blackjack
+     * @return Retorno en centavos, apuesta incluida
+     * @pre 0 <= apuesta <= Dinero::APUESTA_MAXIMA; Asientos no deja que una
+     *      mano doblada pase de ese máximo
+     */
+    static Centavos retornoDe(int8_t resultado, Centavos apuesta,
+                              int64_t numerador = Reglas::PAGO_BLACKJACK_NUMERADOR,
+                              int64_t denominador = Reglas::PAGO_BLACKJACK_DENOMINADOR);
+
+    /**
+     * @brief Resuelve cada mano contra la mano final del crupier
+     * @param totales Total de cada mano
+     * @param estados Estado de cada mano
+     * @param numAsientos Número de manos
+     * @param totalCrupier Total final del crupier
+     * @param blackjackCrupier true si el crupier tiene Blackjack
+     * @param resultados Salida: un código por mano (PIERDE para huecos sin mano)
+     */
+    static void resolverAsientos(const uint8_t* totales, const EstadoAsiento* estados, size_t numAsientos,
+                                 int totalCrupier, bool blackjackCrupier, int8_t* resultados);
+
+    /**
+     * @brief Calcula el resultado y el retorno de cada posición
+     * @param resultadosAsiento Resultado de cada asiento
+     * @param asientosPosicion Asiento de cada posición
+     * @param apuestas Apuesta de cada posición en centavos (0 si no apostó)
+     * @param numPosiciones Número de posiciones
+     * @param resultados Salida: resultado de cada posición
+     * @param retornos Salida: retorno de cada posición (0 si no apostó)
+     * @param numerador Numerador del pago del Blackjack
+     * @param denominador Denominador del pago del Blackjack
+     * @pre Cada apuesta es a lo sumo Dinero::APUESTA_MAXIMA
+     */
+    static void calcularRetornos(const int8_t* resultadosAsiento, const uint8_t* asientosPosicion,
+                                 const Centavos* apuestas, size_t numPosiciones,
+                                 int8_t* resultados, Centavos* retornos,
+                                 int64_t numerador = Reglas::PAGO_BLACKJACK_NUMERADOR,
+                                 int64_t denominador = Reglas::PAGO_BLACKJACK_DENOMINADOR);
+
+    /**
+     * @brief Asigna el pago del Blackjack de una variante
+     * @param reglas Reglas de la mesa; solo se usa pagoBlackjack
+     * @post Las próximas liquidaciones pagan el Blackjack con esa proporción
+     */
+    void establecerReglas(const ConfiguracionReglas& reglas);
+
+    /**
+     * @brief Liquida todas las posiciones de una mesa
+     * @param asientos Asientos al final de la ronda
+     * @param manoCrupier Mano final del crupier
+     * @return false si el retorno de alguna posición no cabe en 64 bits
+     * @post obtenerResultados(), obtenerRetornos() y obtenerDesbordados()
+     *       tienen una entrada por posición, y obtenerResultadosMano() una por
+     *       mano en uso; una posición desbordada tiene retorno 0
+     */
+    bool liquidar(const Asientos& asientos, const Mano& manoCrupier);
+
+    /**
+     * @brief Obtiene el resultado de cada posición en la primera mano de su asiento
+     * @return Códigos de resultado
+     */
+    const vector<int8_t>& obtenerResultados() const;
+
+    /**
+     * @brief Obtiene el resultado de cada mano
+     * @return Códigos de resultado, indexados por Asientos::indiceMano()
+     */
+    const vector<int8_t>& obtenerResultadosMano() const;
+
+    /**
+     * @brief Obtiene el retorno de cada posición
+     * @return Retornos en centavos, con apuestas, manos divididas y seguro
+     */
+    const vector<Centavos>& obtenerRetornos() const;
+
+    /**
+     * @brief Obtiene qué posiciones no se pudieron liquidar
+     * @return 1 por posición cuyo retorno desbordaría, 0 en las demás
+     */
+    const vector<uint8_t>& obtenerDesbordados() const;
+};
+
+#endif // LIQUIDACION_H
@@ -5,63 +5,78 @@ using namespace std;
 /**
  * Constructor que inicializa una mano vacía
  */
-Mano::Mano() {}
+Mano::Mano() : estado(EstadoMano::VACIA), numCartas(0) {}
 
 /**
- * Agrega una carta a la mano
+ * Agrega una carta a la mano y avanza el estado con la tabla de transiciones
  */
-void Mano::agregarCarta(shared_ptr<Carta> carta) {
-    if (carta != nullptr) {
+void Mano::agregarCarta(Carta carta) {
+    if (carta.esValida()) {
         cartas.push_back(carta);
+        estado = EstadoMano::siguiente(estado, carta.obtenerRango());
+        numCartas++;
     }
 }
 
 /**
  * Calcula el valor total de la mano considerando los Ases
- * Los Ases pueden valer 1 u 11 dependiendo de qué sea mejor
+ * Como máximo un As puede valer 11; vale 11 solo si no se pasa de 21
  */
 int Mano::calcularValor() const {
-    int valor = 0;
-    int ases = 0;
-
-    // Sumar valores base y contar Ases
-    for (const auto& carta : cartas) {
-        if (carta->esAs()) {
-            ases++;
-            valor += 11;  // Inicialmente contar As como 11
-        } else {
-            valor += carta->obtenerValorNumerico();
-        }
-    }
+    return estado != EstadoMano::PASADA_MAXIMA ? EstadoMano::valor(estado) : sumarCartas();
+}
 
-    // Ajustar Ases de 11 a 1 si es necesario
-    while (valor > 21 && ases > 0) {
-        valor -= 10;  // Cambiar un As de 11 a 1
-        ases--;
+/**
+ * Suma de las cartas con cada As como 1; solo hace falta más allá de 30
+ */
+int Mano::sumarCartas() const {
+    int total = 0;
+    for (const Carta& carta : cartas) {
+        total += carta.esAs() ? 1 : carta.obtenerValorNumerico();
     }
-
-    return valor;
+    return total;
 }
 
 /**
  * Obtiene el número de cartas en la mano
  */
 int Mano::obtenerNumeroCartas() const {
-    return cartas.size();
+    return numCartas;
+}
+
+/**
+ * Getter del estado de la mano
+ */
+uint8_t Mano::obtenerEstado() const {
+    return estado;
+}
+
+/**
+ * Verifica si la mano es suave (un As puede contar como 11)
+ */
+bool Mano::esSuave() const {
+    return EstadoMano::esSuave(estado);
+}
+
+/**
+ * Verifica si la mano es una pareja (dos cartas del mismo valor)
+ */
+bool Mano::esPar() const {
+    return numCartas == 2 && cartas[0].obtenerIndiceValor() == cartas[1].obtenerIndiceValor();
 }
 
 /**
  * Verifica si la mano es Blackjack (21 con exactamente 2 cartas)
  */
 bool Mano::esBlackjack() const {
-    return obtenerNumeroCartas() == 2 && calcularValor() == 21;
+    return estado == EstadoMano::BLACKJACK;
 }
 
 /**
  * Verifica si la mano se pasó de 21
  */
 bool Mano::sePaso() const {
-    return calcularValor() > 21;
+    return EstadoMano::sePaso(estado);
 }
 
 /**
@@ -69,12 +84,14 @@ bool Mano::sePaso() const {
  */
 void Mano::limpiar() {
     cartas.clear();
+    estado = EstadoMano::VACIA;
+    numCartas = 0;
 }
 
 /**
  * Obtiene todas las cartas de la mano
  */
-vector<shared_ptr<Carta>> Mano::obtenerCartas() const {
+const vector<Carta>& Mano::obtenerCartas() const {
     return cartas;
 }
 
@@ -90,7 +107,7 @@ string Mano::toString() const {
     ss << "Cartas: ";
     for (size_t i = 0; i < cartas.size(); ++i) {
         if (i > 0) ss << ", ";
-        ss << cartas[i]->toString();
+        ss << cartas[i].toString();
     }
     ss << " (Valor: " << calcularValor() << ")";
     return ss.str();
@@ -106,7 +123,7 @@ string Mano::toStringParcial() const {
     }
 
     stringstream ss;
-    ss << "Cartas: " << cartas[0]->toString();
+    ss << "Cartas: " << cartas[0].toString();
     if (cartas.size() > 1) {
         ss << ", [Carta oculta]";
     }
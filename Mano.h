@@ -2,8 +2,8 @@
 #define MANO_H
 
 #include "Carta.h"
+#include "EstadoMano.h"
 #include <vector>
-#include <memory>
 using namespace std;
 
 /**
@@ -12,10 +12,21 @@ using namespace std;
  * 
  * Esta clase gestiona las cartas que tiene un jugador o crupier,
  * calcula el valor total y maneja la lógica especial de los Ases.
+ * El estado de la mano (ver EstadoMano) se avanza con una consulta a una
+ * tabla constexpr por cada carta, por lo que todas las consultas de valor
+ * son de tiempo constante.
  */
 class Mano {
 private:
-    vector<shared_ptr<Carta>> cartas;  ///< Vector de cartas en la mano
+    vector<Carta> cartas;  ///< Vector de cartas en la mano
+    uint8_t estado;        ///< Estado de la mano en EstadoMano
+    int numCartas;         ///< Número de cartas en la mano
+
+    /**
+     * @brief Suma las cartas una a una
+     * @return Valor exacto de una mano pasada con 31 o más
+     */
+    int sumarCartas() const;
 
 public:
     /**
@@ -31,11 +42,11 @@ public:
 
     /**
      * @brief Agrega una carta a la mano
-     * @param carta Puntero compartido a la carta a agregar
-     * @pre carta no debe ser nullptr
+     * @param carta Carta a agregar
+     * @pre carta debe ser válida
      * @post La carta se agrega a la mano
      */
-    void agregarCarta(shared_ptr<Carta> carta);
+    void agregarCarta(Carta carta);
 
     /**
      * @brief Calcula el valor total de la mano
@@ -50,6 +61,24 @@ public:
      */
     int obtenerNumeroCartas() const;
 
+    /**
+     * @brief Obtiene el estado de la mano
+     * @return Estado en EstadoMano
+     */
+    uint8_t obtenerEstado() const;
+
+    /**
+     * @brief Verifica si la mano es suave (un As cuenta como 11)
+     * @return true si algún As vale 11 sin pasarse de 21, false en caso contrario
+     */
+    bool esSuave() const;
+
+    /**
+     * @brief Verifica si la mano es una pareja que se puede dividir
+     * @return true si tiene exactamente 2 cartas del mismo valor
+     */
+    bool esPar() const;
+
     /**
      * @brief Verifica si la mano es Blackjack
      * @return true si es Blackjack (21 con 2 cartas), false en caso contrario
@@ -70,9 +99,9 @@ public:
 
     /**
      * @brief Obtiene todas las cartas de la mano
-     * @return Vector de punteros compartidos a las cartas
+     * @return Referencia constante al vector de cartas
      */
-    vector<shared_ptr<Carta>> obtenerCartas() const;
+    const vector<Carta>& obtenerCartas() const;
 
     /**
      * @brief Convierte la mano a string para mostrar
@@ -1,31 +1,36 @@
 #include "Mazo.h"
 #include <algorithm>
-#include <random>
-#include <chrono>
 using namespace std;
 
 /**
- * Constructor que inicializa y baraja el mazo
+ * Constructor que inicializa y baraja el zapato
+ * El número de barajas se limita al rango [1, MAX_BARAJAS]
  */
-Mazo::Mazo() : indiceCarta(0) {
+Mazo::Mazo(int numBarajas, double penetracion)
+    : indiceCarta(0), numBarajas(clamp(numBarajas, 1, MAX_BARAJAS)), posicionCorte(0),
+      semilla(GeneradorAleatorio::semillaDelSistema()),
+      generador(make_unique<Xoshiro256EstrellaEstrella>(semilla)) {
+    cartas.reserve(this->numBarajas * CARTAS_POR_BARAJA);
+    cuentasIniciales = Conteo::cuentasIniciales(this->numBarajas);
     inicializarMazo();
+    indicesBarajado.resize(cartas.size());
+    establecerPenetracion(penetracion);
     barajar();
 }
 
 /**
- * Inicializa el mazo con las 52 cartas estándar
- * 4 palos × 13 valores = 52 cartas
+ * Inicializa el zapato con las barajas estándar
+ * numBarajas × 4 palos × 13 valores
  */
 void Mazo::inicializarMazo() {
-    vector<string> palos = {"Corazones", "Diamantes", "Tréboles", "Picas"};
-    vector<string> valores = {"A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"};
-
     cartas.clear();
 
-    // Crear todas las combinaciones de cartas
-    for (const string& palo : palos) {
-        for (const string& valor : valores) {
-            cartas.push_back(make_shared<Carta>(valor, palo));
+    // Crear todas las combinaciones de cartas de cada baraja
+    for (int baraja = 0; baraja < numBarajas; baraja++) {
+        for (uint8_t palo = 0; palo < Carta::NUM_PALOS; palo++) {
+            for (uint8_t rango = 0; rango < Carta::NUM_RANGOS; rango++) {
+                cartas.emplace_back(rango, palo);
+            }
         }
     }
 
@@ -33,24 +38,98 @@ void Mazo::inicializarMazo() {
 }
 
 /**
- * Baraja las cartas usando un generador aleatorio
+ * Baraja las cartas con Fisher-Yates
+ * Los índices de intercambio se piden al generador en un solo lote
  */
 void Mazo::barajar() {
-    // Usar tiempo actual como semilla para mayor aleatoriedad
-    unsigned seed = chrono::system_clock::now().time_since_epoch().count();
-    shuffle(cartas.begin(), cartas.end(), default_random_engine(seed));
+    uint32_t n = static_cast<uint32_t>(cartas.size());
+    generador->generarIndicesBarajado(indicesBarajado.data(), n);
+    for (uint32_t i = n; i-- > 1;) {
+        swap(cartas[i], cartas[indicesBarajado[i]]);
+    }
     indiceCarta = 0;
+    reiniciarComposicion();
+}
+
+/**
+ * Composición de un zapato completo: 4 cartas de cada valor por baraja
+ * y 16 de valor 10 (10, J, Q, K); las cuentas vuelven a su valor inicial
+ */
+void Mazo::reiniciarComposicion() {
+    restantes.fill(static_cast<uint16_t>(Carta::NUM_PALOS * numBarajas));
+    restantes[Carta::NUM_VALORES - 1] = static_cast<uint16_t>(4 * Carta::NUM_PALOS * numBarajas);
+    etiquetasSumadas = 0;
+}
+
+/**
+ * Getter para la composición restante del zapato
+ */
+const Composicion& Mazo::obtenerComposicion() const {
+    return restantes;
+}
+
+/**
+ * Cuenta corriente: cuenta inicial más las etiquetas repartidas
+ */
+int Mazo::cuentaCorriente(SistemaConteo sistema) const {
+    return cuentasIniciales[static_cast<int>(sistema)] +
+           Conteo::desempaquetar(etiquetasSumadas, indiceCarta, sistema);
+}
+
+/**
+ * Cuenta verdadera con las barajas restantes
+ */
+double Mazo::cuentaVerdadera(SistemaConteo sistema) const {
+    return cuentaCorriente(sistema) * static_cast<double>(CARTAS_POR_BARAJA) / max(cartasRestantes(), 1);
+}
+
+/**
+ * Barajas restantes a partir de las cartas sin repartir
+ */
+double Mazo::barajasRestantes() const {
+    return static_cast<double>(cartasRestantes()) / CARTAS_POR_BARAJA;
+}
+
+/**
+ * Siembra el generador y baraja partiendo del orden inicial del zapato
+ * Restaurar el orden inicial hace que el resultado no dependa del historial
+ */
+void Mazo::sembrar(uint64_t nuevaSemilla) {
+    semilla = nuevaSemilla;
+    generador->sembrar(semilla);
+    inicializarMazo();
+    barajar();
+}
+
+/**
+ * Getter para la semilla del generador
+ */
+uint64_t Mazo::obtenerSemilla() const {
+    return semilla;
+}
+
+/**
+ * Cambia el motor aleatorio conservando la semilla actual
+ */
+void Mazo::establecerGenerador(unique_ptr<GeneradorAleatorio> nuevoGenerador) {
+    if (nuevoGenerador == nullptr) return;
+    generador = move(nuevoGenerador);
+    sembrar(semilla);
 }
 
 /**
  * Reparte la siguiente carta disponible
  */
-shared_ptr<Carta> Mazo::repartirCarta() {
+Carta Mazo::repartirCarta() {
     if (estaVacio()) {
-        return nullptr;  // No hay cartas disponibles
+        return Carta();  // No hay cartas disponibles
     }
 
-    return cartas[indiceCarta++];
+    Carta carta = cartas[indiceCarta++];
+    uint8_t indiceValor = carta.obtenerIndiceValor();
+    restantes[indiceValor]--;
+    etiquetasSumadas += Conteo::ETIQUETAS_EMPAQUETADAS[indiceValor];  // Todos los sistemas en una suma
+    return carta;
 }
 
 /**
@@ -64,13 +143,51 @@ int Mazo::cartasRestantes() const {
  * Verifica si se han repartido todas las cartas
  */
 bool Mazo::estaVacio() const {
-    return indiceCarta >= cartas.size();
+    return indiceCarta >= static_cast<int>(cartas.size());
+}
+
+/**
+ * Verifica si la próxima carta está después de la carta de corte
+ */
+bool Mazo::alcanzoCorte() const {
+    return indiceCarta >= posicionCorte;
+}
+
+/**
+ * Coloca la carta de corte según la penetración indicada
+ * Siempre deja al menos una carta antes del corte
+ */
+void Mazo::establecerPenetracion(double penetracion) {
+    penetracion = clamp(penetracion, 0.0, 1.0);
+    posicionCorte = max(1, static_cast<int>(cartas.size() * penetracion));
+}
+
+/**
+ * Getter para la posición de la carta de corte
+ */
+int Mazo::obtenerPosicionCorte() const {
+    return posicionCorte;
+}
+
+/**
+ * Getter para el número de barajas del zapato
+ */
+int Mazo::obtenerNumBarajas() const {
+    return numBarajas;
+}
+
+/**
+ * Obtiene el total de cartas del zapato
+ */
+int Mazo::cartasTotales() const {
+    return cartas.size();
 }
 
 /**
  * Reinicia el mazo completo y lo baraja
+ * Las cartas repartidas siguen en el arreglo, así que basta con volver a
+ * barajar todo el zapato en su lugar
  */
 void Mazo::reiniciar() {
-    inicializarMazo();
     barajar();
 }
\ No newline at end of file
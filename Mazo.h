@@ -2,34 +2,73 @@
 #define MAZO_H
 
 #include "Carta.h"
+#include "Conteo.h"
+#include "GeneradorAleatorio.h"
+#include <array>
 #include <vector>
 #include <memory>
 using namespace std;
 
+/// Cartas restantes por índice de valor (0 = As, 1-8 = 2-9, 9 = 10/J/Q/K)
+using Composicion = array<uint16_t, Carta::NUM_VALORES>;
+
 /**
  * @class Mazo
  * @brief Representa un mazo de cartas para el juego de Blackjack
  * 
  * Esta clase gestiona el conjunto de cartas, su inicialización, barajado
  * y reparto. Implementa encapsulamiento ocultando la estructura interna.
+ *
+ * El mazo funciona como un zapato de una o varias barajas guardadas en un
+ * arreglo contiguo de cartas compactas. Una carta de corte marca la
+ * penetración: al alcanzarla, el zapato pide barajarse antes de la
+ * siguiente ronda, nunca en medio de una mano.
+ *
+ * El barajado usa Fisher-Yates con un generador intercambiable y sembrable,
+ * de modo que una misma semilla reproduce exactamente la misma sesión.
+ *
+ * Al repartir, el zapato actualiza las cuentas de todos los sistemas de
+ * Conteo, así que la cuenta corriente y la verdadera se consultan en O(1).
  */
 class Mazo {
+public:
+    static constexpr int CARTAS_POR_BARAJA = Carta::NUM_RANGOS * Carta::NUM_PALOS; ///< 52 cartas
+    static constexpr int MAX_BARAJAS = 8;  ///< Máximo de barajas en el zapato (416 cartas)
+
 private:
-    vector<shared_ptr<Carta>> cartas;  ///< Vector de cartas en el mazo
-    int indiceCarta;                   ///< Índice de la próxima carta a repartir
+    vector<Carta> cartas;  ///< Cartas del zapato en orden de reparto
+    int indiceCarta;       ///< Índice de la próxima carta a repartir
+    int numBarajas;        ///< Número de barajas en el zapato
+    int posicionCorte;     ///< Índice de la carta de corte
+    uint64_t semilla;      ///< Última semilla usada para el generador
+    unique_ptr<GeneradorAleatorio> generador;  ///< Motor aleatorio del barajado
+    vector<uint32_t> indicesBarajado;          ///< Índices de Fisher-Yates (reservados una vez)
+    Composicion restantes;                     ///< Cartas sin repartir por valor
+    uint64_t etiquetasSumadas;                 ///< Suma de Conteo::ETIQUETAS_EMPAQUETADAS desde el barajado
+    Conteo::Cuentas cuentasIniciales;          ///< Cuenta inicial de cada sistema
+
+    /**
+     * @brief Restablece la composición de un zapato completo
+     * @post restantes refleja numBarajas barajas sin repartir y las cuentas
+     *       vuelven a su valor inicial
+     */
+    void reiniciarComposicion();
 
     /**
-     * @brief Inicializa el mazo con las 52 cartas estándar
-     * @post El mazo contiene todas las cartas de una baraja estándar
+     * @brief Inicializa el zapato con numBarajas barajas estándar
+     * @post El zapato contiene numBarajas × 52 cartas
+     * @note Solo se llama al construir y al sembrar; el reinicio reutiliza las cartas
      */
     void inicializarMazo();
 
 public:
     /**
      * @brief Constructor de la clase Mazo
-     * @post Crea un mazo completo y lo baraja
+     * @param numBarajas Número de barajas del zapato (1-8)
+     * @param penetracion Fracción del zapato que se reparte antes de barajar (0-1]
+     * @post Crea un zapato completo y lo baraja
      */
-    Mazo();
+    Mazo(int numBarajas = 1, double penetracion = 0.75);
 
     /**
      * @brief Baraja las cartas del mazo
@@ -37,13 +76,34 @@ public:
      */
     void barajar();
 
+    /**
+     * @brief Siembra el generador y vuelve a barajar desde el orden inicial
+     * @param semilla Semilla del generador
+     * @post La secuencia de cartas depende únicamente de la semilla
+     */
+    void sembrar(uint64_t semilla);
+
+    /**
+     * @brief Obtiene la última semilla usada
+     * @return Semilla del generador
+     */
+    uint64_t obtenerSemilla() const;
+
+    /**
+     * @brief Reemplaza el generador aleatorio del barajado
+     * @param nuevoGenerador Generador a usar (se siembra con la semilla actual)
+     * @pre nuevoGenerador no debe ser nullptr
+     * @post El zapato se vuelve a barajar con el nuevo generador
+     */
+    void establecerGenerador(unique_ptr<GeneradorAleatorio> nuevoGenerador);
+
     /**
      * @brief Reparte la siguiente carta del mazo
-     * @return Puntero compartido a la carta repartida
+     * @return Carta repartida (inválida si el mazo está vacío)
      * @pre Debe haber cartas disponibles en el mazo
      * @post La carta es removida del mazo disponible
      */
-    shared_ptr<Carta> repartirCarta();
+    Carta repartirCarta();
 
     /**
      * @brief Obtiene el número de cartas restantes en el mazo
@@ -51,15 +111,74 @@ public:
      */
     int cartasRestantes() const;
 
+    /**
+     * @brief Obtiene la composición de las cartas que quedan por repartir
+     * @return Cartas restantes por índice de valor
+     * @post Se mantiene al repartir, sin recorrer el zapato
+     */
+    const Composicion& obtenerComposicion() const;
+
+    /**
+     * @brief Obtiene la cuenta corriente de un sistema
+     * @param sistema Sistema de conteo
+     * @return Cuenta desde el último barajado, partiendo de Conteo::cuentaInicial
+     */
+    int cuentaCorriente(SistemaConteo sistema) const;
+
+    /**
+     * @brief Obtiene la cuenta verdadera de un sistema
+     * @param sistema Sistema de conteo
+     * @return Cuenta corriente dividida entre las barajas que quedan
+     * @note Con menos de una carta se divide entre 1/52 para no dividir entre cero
+     */
+    double cuentaVerdadera(SistemaConteo sistema) const;
+
+    /**
+     * @brief Estima las barajas que quedan por repartir
+     * @return Cartas restantes / 52
+     */
+    double barajasRestantes() const;
+
     /**
      * @brief Verifica si el mazo está vacío
      * @return true si no hay cartas, false en caso contrario
      */
     bool estaVacio() const;
 
+    /**
+     * @brief Verifica si ya se alcanzó la carta de corte
+     * @return true si el zapato debe barajarse antes de la próxima ronda
+     */
+    bool alcanzoCorte() const;
+
+    /**
+     * @brief Cambia la penetración y recoloca la carta de corte
+     * @param penetracion Fracción del zapato que se reparte antes de barajar (0-1]
+     */
+    void establecerPenetracion(double penetracion);
+
+    /**
+     * @brief Obtiene la posición de la carta de corte
+     * @return Índice de la primera carta después del corte
+     */
+    int obtenerPosicionCorte() const;
+
+    /**
+     * @brief Obtiene el número de barajas del zapato
+     * @return Número de barajas
+     */
+    int obtenerNumBarajas() const;
+
+    /**
+     * @brief Obtiene el total de cartas del zapato
+     * @return numBarajas × 52
+     */
+    int cartasTotales() const;
+
     /**
      * @brief Reinicia el mazo completo
      * @post El mazo vuelve a tener todas las cartas barajadas
+     * @note Permuta las cartas existentes en su lugar, sin reservar memoria
      */
     void reiniciar();
 };
@@ -0,0 +1,385 @@
+#include "MotorRepeticion.h"
+#include "Liquidacion.h"
+#include "Reglas.h"
+#include <chrono>
+#include <sstream>
+using namespace std;
+
+/**
+ * Manos verificadas por segundo
+ */
+double ResultadoRepeticion::manosPorSegundo() const {
+    return segundos > 0.0 ? manos / segundos : 0.0;
+}
+
+/**
+ * Resumen legible de la repetición
+ */
+string ResultadoRepeticion::toString() const {
+    stringstream ss;
+    ss << (correcto ? "Historial verificado" : "DISCREPANCIA en el evento " + to_string(indiceError) + ": " + error)
+       << "\nEventos: " << eventos << " | Sesiones: " << sesiones << " | Rondas: " << rondas
+       << " | Manos: " << manos << " | Cartas: " << cartas
+       << "\nTiempo: " << segundos << " s | Manos por segundo: " << manosPorSegundo();
+    return ss.str();
+}
+
+/**
+ * Deja el asiento con una sola mano vacía y sin apuesta
+ */
+void AsientoRepeticion::reiniciar() {
+    for (Mano& mano : manos) {
+        mano.limpiar();
+    }
+    apuestas.fill(0);
+    cerradas.fill(0);
+    numManos = 1;
+    manoActiva = 0;
+    manoLiquidada = 0;
+    cartaPedida = false;
+    doblando = false;
+    rendida = false;
+    apuestasDetras.clear();
+    liquidadasDetras.clear();
+}
+
+/**
+ * El titular apuesta a la primera mano; los demás, por orden detrás de él
+ */
+Centavos AsientoRepeticion::apuestaDe(uint8_t apostador) const {
+    if (apostador == 0) {
+        return apuestas[0];
+    }
+    return apostador <= apuestasDetras.size() ? apuestasDetras[apostador - 1u] : 0;
+}
+
+/**
+ * Avanza mientras la mano activa esté cerrada y queden manos detrás
+ */
+int AsientoRepeticion::avanzar() {
+    while (manoActiva + 1 < numManos && cerradas[manoActiva]) {
+        manoActiva++;
+    }
+    return manoActiva;
+}
+
+/**
+ * Constructor que prepara la salida nula del crupier
+ */
+MotorRepeticion::MotorRepeticion()
+    : salidaNula(SalidaJuego::crear(ModoSalida::NULA)), crupierVerificado(false) {}
+
+/**
+ * Crea el crupier de la sesión con el mismo zapato, corte y semilla
+ */
+void MotorRepeticion::iniciarSesion(const EventoHistorial& evento) {
+    int cartasTotales = evento.numBarajas * Mazo::CARTAS_POR_BARAJA;
+    // El punto medio de la carta de corte reproduce exactamente su posición
+    double penetracion = (evento.posicionCorte + 0.5) / cartasTotales;
+    crupier = make_unique<Crupier>(evento.numBarajas, penetracion);
+    reglas = ConfiguracionReglas();
+    reglas.rendicionTardia = true;
+    reglas.numBarajas = evento.numBarajas;
+    crupier->establecerReglas(reglas);
+    crupier->establecerSalida(salidaNula.get());
+    crupier->sembrar(evento.semilla);
+    iniciarRonda();
+}
+
+/**
+ * Limpia las manos del crupier y de los asientos
+ */
+void MotorRepeticion::iniciarRonda() {
+    if (crupier) {
+        crupier->reiniciarMano();
+    }
+    for (AsientoRepeticion& asiento : asientos) {
+        asiento.reiniciar();
+    }
+    crupierVerificado = false;
+}
+
+/**
+ * Asiento por número; los asientos se crean la primera vez que aparecen
+ */
+AsientoRepeticion& MotorRepeticion::asientoEn(uint8_t asiento) {
+    if (asientos.size() <= asiento) {
+        asientos.resize(asiento + 1u);
+    }
+    return asientos[asiento];
+}
+
+/**
+ * Pedir y doblar esperan carta; dividir mueve la segunda carta a una mano
+ * nueva con la misma apuesta; plantarse y rendirse cierran la mano. Doblar
+ * tras dividir, el límite de manos y la rendición siguen a la variante. Las
+ * acciones que solo usa la estrategia cuentan como plantarse
+ */
+const char* MotorRepeticion::decidir(AsientoRepeticion& asiento, Accion accion, const ConfiguracionReglas& reglas) {
+    int indice = asiento.avanzar();
+    Mano& mano = asiento.manos[indice];
+    if (asiento.apuestas[0] == 0 || asiento.cerradas[indice] || mano.sePaso()) {
+        return "Decisión de un asiento sin mano activa";
+    }
+
+    switch (accion) {
+        case Accion::PEDIR:
+            asiento.cartaPedida = true;
+            return nullptr;
+
+        case Accion::DOBLAR:
+            if (mano.obtenerNumeroCartas() != 2) {
+                return "Doble sin dos cartas";
+            }
+            if (asiento.numManos > 1 && !reglas.doblarTrasDividir) {
+                return "Doble de una mano dividida sin doblar tras dividir";
+            }
+            asiento.apuestas[indice] *= 2;
+            asiento.cartaPedida = true;
+            asiento.doblando = true;
+            return nullptr;
+
+        case Accion::DIVIDIR: {
+            if (!mano.esPar() || asiento.numManos >= reglas.manosPermitidas()) {
+                return "División sin pareja o sin manos libres";
+            }
+            Carta primera = mano.obtenerCartas()[0];
+            Carta segunda = mano.obtenerCartas()[1];
+            Mano& nueva = asiento.manos[asiento.numManos];
+            mano.limpiar();
+            mano.agregarCarta(primera);
+            nueva.limpiar();
+            nueva.agregarCarta(segunda);
+            asiento.apuestas[asiento.numManos] = asiento.apuestas[indice];
+            asiento.numManos++;
+            return nullptr;
+        }
+
+        case Accion::RENDIRSE:
+            if (!reglas.rendicionTardia) {
+                return "Rendición sin rendición tardía";
+            }
+            if (asiento.numManos != 1 || mano.obtenerNumeroCartas() != 2) {
+                return "Rendición fuera de la mano inicial";
+            }
+            asiento.rendida = true;
+            asiento.cerradas[indice] = 1;
+            return nullptr;
+
+        default:
+            asiento.cerradas[indice] = 1;
+            return nullptr;
+    }
+}
+
+/**
+ * Verifica un evento contra el estado reconstruido
+ */
+const char* MotorRepeticion::procesar(const EventoHistorial& evento, ResultadoRepeticion& resultado) {
+    if (evento.tipo == TipoEvento::DESCONOCIDO) {
+        return "Tipo de evento desconocido";
+    }
+    if (evento.tipo == TipoEvento::INICIO_SESION) {
+        iniciarSesion(evento);
+        resultado.sesiones++;
+        return nullptr;
+    }
+    if (!crupier) {
+        return "Evento antes del inicio de sesión";
+    }
+
+    switch (evento.tipo) {
+        case TipoEvento::INICIO_RONDA:
+            iniciarRonda();
+            resultado.rondas++;
+            return nullptr;
+
+        case TipoEvento::BARAJADO: {
+            const Mazo& zapato = crupier->obtenerMazo();
+            if (!zapato.alcanzoCorte() && !zapato.estaVacio()) {
+                return "Barajado antes de la carta de corte";
+            }
+            crupier->reiniciarMazo();
+            return nullptr;
+        }
+
+        case TipoEvento::REGLAS:
+            reglas = evento.reglas;
+            reglas.numBarajas = crupier->obtenerMazo().obtenerNumBarajas();
+            crupier->establecerReglas(reglas);
+            return nullptr;
+
+        case TipoEvento::APUESTA: {
+            if (evento.centavos <= 0 || evento.centavos > Dinero::APUESTA_MAXIMA) {
+                return "Apuesta fuera de rango";
+            }
+            AsientoRepeticion& asiento = asientoEn(evento.asiento);
+            if (evento.apostador == 0) {
+                asiento.apuestas[0] = evento.centavos;
+                return nullptr;
+            }
+            // Solo se apuesta detrás de una mano que juega
+            if (asiento.apuestas[0] == 0) {
+                return "Apuesta detrás de un asiento sin apuesta";
+            }
+            if (asiento.apuestasDetras.size() < evento.apostador) {
+                asiento.apuestasDetras.resize(evento.apostador);
+                asiento.liquidadasDetras.resize(evento.apostador);
+            }
+            asiento.apuestasDetras[evento.apostador - 1u] = evento.centavos;
+            return nullptr;
+        }
+
+        case TipoEvento::SEGURO: {
+            const Mano& manoCrupier = crupier->obtenerMano();
+            if (manoCrupier.obtenerCartas().empty() || !manoCrupier.obtenerCartas()[0].esAs()) {
+                return "Seguro sin As del crupier";
+            }
+            Centavos apuesta = asientoEn(evento.asiento).apuestaDe(evento.apostador);
+            if (apuesta == 0 || evento.centavos != apuesta / 2) {
+                return "Seguro distinto de media apuesta";
+            }
+            return nullptr;
+        }
+
+        case TipoEvento::CARTA: {
+            if (crupier->obtenerMazo().estaVacio()) {
+                return "Zapato agotado sin barajado registrado";
+            }
+            Carta carta = crupier->repartirCarta();
+            resultado.cartas++;
+            if (carta != evento.carta) {
+                return "Carta distinta a la del zapato";
+            }
+
+            if (evento.asiento == EventoHistorial::ASIENTO_CRUPIER) {
+                if (crupier->obtenerMano().obtenerCartas().size() >= 2 &&
+                    (!crupier->quiereOtraCarta() || crupier->obtenerMano().sePaso())) {
+                    return "El crupier pidió carta sin deber hacerlo";
+                }
+                crupier->recibirCarta(carta);
+                return nullptr;
+            }
+
+            AsientoRepeticion& asiento = asientoEn(evento.asiento);
+            if (asiento.apuestas[0] == 0) {
+                return "Carta para un asiento sin apuesta";
+            }
+            int indice = asiento.avanzar();
+            Mano& mano = asiento.manos[indice];
+            if (mano.obtenerNumeroCartas() >= 2) {
+                if (!asiento.cartaPedida) {
+                    return "Carta sin decisión de pedir";
+                }
+                asiento.cartaPedida = false;
+            }
+            mano.agregarCarta(carta);
+
+            // Una mano dividida se completa sola con Ases o con 21
+            bool dividida = asiento.numManos > 1;
+            bool completa = dividida && mano.obtenerNumeroCartas() == 2 &&
+                            (mano.obtenerCartas()[0].esAs() || mano.calcularValor() == 21);
+            if (mano.sePaso() || asiento.doblando || completa) {
+                asiento.cerradas[indice] = 1;
+                asiento.doblando = false;
+            }
+            return nullptr;
+        }
+
+        case TipoEvento::DECISION:
+            return decidir(asientoEn(evento.asiento), evento.accion, reglas);
+
+        case TipoEvento::LIQUIDACION: {
+            AsientoRepeticion& asiento = asientoEn(evento.asiento);
+            bool titular = evento.apostador == 0;
+            if (asiento.apuestaDe(evento.apostador) == 0) {
+                return "Liquidación de un asiento sin apuesta";
+            }
+            if (titular ? asiento.manoLiquidada >= asiento.numManos
+                        : asiento.liquidadasDetras[evento.apostador - 1u]) {
+                return "Liquidación de una mano que no se jugó";
+            }
+
+            // La regla del crupier se verifica una vez, cuando ya terminó su turno
+            if (!crupierVerificado) {
+                bool hayManosEnJuego = false;
+                for (const AsientoRepeticion& otro : asientos) {
+                    for (int i = 0; i < otro.numManos; i++) {
+                        hayManosEnJuego |= otro.apuestas[0] > 0 && !otro.rendida && !otro.manos[i].sePaso();
+                    }
+                }
+                const Mano& manoCrupier = crupier->obtenerMano();
+                if (hayManosEnJuego ? (crupier->quiereOtraCarta() && !manoCrupier.sePaso())
+                                    : manoCrupier.obtenerCartas().size() != 2) {
+                    return "El crupier no terminó su turno según las reglas";
+                }
+                crupierVerificado = true;
+            }
+
+            // Las manos del titular se liquidan en el orden en que se jugaron;
+            // quien apuesta detrás sigue la primera con su propia apuesta
+            int indice = 0;
+            Centavos apuesta = asiento.apuestaDe(evento.apostador);
+            if (titular) {
+                indice = asiento.manoLiquidada++;
+                apuesta = asiento.apuestas[indice];
+            } else {
+                asiento.liquidadasDetras[evento.apostador - 1u] = 1;
+            }
+            const Mano& mano = asiento.manos[indice];
+            bool dividida = asiento.numManos > 1;
+            int resultadoMano = asiento.rendida ? Liquidacion::RINDE
+                                                : Reglas::compararManos(mano, crupier->obtenerMano(), dividida);
+            if (resultadoMano != evento.resultado) {
+                return "Resultado distinto";
+            }
+            if (mano.calcularValor() != evento.totalJugador ||
+                crupier->obtenerMano().calcularValor() != evento.totalCrupier) {
+                return "Total distinto";
+            }
+            // El Blackjack que gana se paga con la proporción de la variante
+            int8_t codigo = static_cast<int8_t>(resultadoMano + (resultadoMano > 0 && mano.esBlackjack() && !dividida));
+            Centavos retorno = Liquidacion::retornoDe(codigo, apuesta, reglas.numeradorBlackjack(),
+                                                      reglas.denominadorBlackjack());
+            if (retorno != evento.centavos) {
+                return "Pago distinto";
+            }
+            resultado.manos++;
+            return nullptr;
+        }
+
+        default:
+            return "Tipo de evento desconocido";
+    }
+}
+
+/**
+ * Procesa los eventos en orden hasta el final o la primera discrepancia
+ */
+ResultadoRepeticion MotorRepeticion::repetir(LectorHistorial::Iterador inicio, LectorHistorial::Iterador fin) {
+    ResultadoRepeticion resultado;
+    crupier.reset();
+    asientos.clear();
+
+    auto comienzo = chrono::steady_clock::now();
+    for (auto it = inicio; it != fin; ++it) {
+        const char* error = procesar(*it, resultado);
+        if (error != nullptr) {
+            resultado.correcto = false;
+            resultado.indiceError = resultado.eventos;
+            resultado.error = error;
+            break;
+        }
+        resultado.eventos++;
+    }
+    chrono::duration<double> duracion = chrono::steady_clock::now() - comienzo;
+    resultado.segundos = duracion.count();
+    return resultado;
+}
+
+/**
+ * Repite el historial completo
+ */
+ResultadoRepeticion MotorRepeticion::repetir(const LectorHistorial& lector) {
+    return repetir(lector.begin(), lector.end());
+}
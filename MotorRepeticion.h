@@ -0,0 +1,170 @@
+#ifndef MOTOR_REPETICION_H
+#define MOTOR_REPETICION_H
+
+#include "ConjuntoReglas.h"
+#include "Crupier.h"
+#include "HistorialBinario.h"
+#include "SalidaJuego.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * @struct ResultadoRepeticion
+ * @brief Resultado de verificar un historial
+ */
+struct ResultadoRepeticion {
+    bool correcto = true;        ///< true si todo el historial coincide
+    uint64_t eventos = 0;        ///< Eventos procesados
+    uint64_t sesiones = 0;       ///< Sesiones (INICIO_SESION) procesadas
+    uint64_t rondas = 0;         ///< Rondas procesadas
+    uint64_t manos = 0;          ///< Liquidaciones verificadas
+    uint64_t cartas = 0;         ///< Cartas verificadas
+    uint64_t indiceError = 0;    ///< Índice del evento que no coincide
+    string error;                ///< Descripción de la discrepancia
+    double segundos = 0.0;       ///< Tiempo de la repetición
+
+    /**
+     * @brief Calcula el rendimiento de la repetición
+     * @return Manos verificadas por segundo
+     */
+    double manosPorSegundo() const;
+
+    /**
+     * @brief Convierte el resultado a string para mostrar
+     * @return Resumen legible
+     */
+    string toString() const;
+};
+
+/**
+ * @struct AsientoRepeticion
+ * @brief Manos reconstruidas de un asiento durante la repetición
+ *
+ * Las cartas y decisiones del asiento van a la mano activa, que avanza a la
+ * siguiente cuando se cierra: al plantarse, pasarse, recibir la carta del
+ * doble, completar unos Ases divididos o llegar a 21 con dos cartas en una
+ * mano dividida. Las manos divididas se agregan al final, en orden de juego.
+ * Quienes apuestan detrás no deciden: solo tienen su apuesta y siguen la
+ * primera mano.
+ */
+struct AsientoRepeticion {
+    static constexpr int MAX_MANOS = ConfiguracionReglas::MAX_MANOS;
+
+    array<Mano, MAX_MANOS> manos;            ///< Manos del asiento
+    array<Centavos, MAX_MANOS> apuestas{};   ///< Apuesta de cada mano (0 si el asiento no apostó)
+    array<uint8_t, MAX_MANOS> cerradas{};    ///< 1 si la mano ya no admite decisiones
+    int numManos = 1;                        ///< Manos en juego
+    int manoActiva = 0;                      ///< Mano que recibe cartas y decisiones
+    int manoLiquidada = 0;                   ///< Siguiente mano por liquidar
+    bool cartaPedida = false;                ///< Pidió o dobló y espera carta
+    bool doblando = false;                   ///< La carta esperada cierra la mano
+    bool rendida = false;                    ///< Se rindió la mano inicial
+    vector<Centavos> apuestasDetras;         ///< Apuesta de cada apostador detrás, por orden (0 si no apostó)
+    vector<uint8_t> liquidadasDetras;        ///< 1 si ese apostador ya se liquidó
+
+    /**
+     * @brief Limpia manos, apuestas y marcas para una ronda nueva
+     */
+    void reiniciar();
+
+    /**
+     * @brief Obtiene la apuesta de una posición del asiento
+     * @param apostador 0 para el titular, k para el k-ésimo que apuesta detrás
+     * @return Apuesta de la primera mano del titular o del apostador, 0 si no apostó
+     */
+    Centavos apuestaDe(uint8_t apostador) const;
+
+    /**
+     * @brief Pasa las manos cerradas hasta la que sigue en juego
+     * @return Índice de la mano activa (la última si todas están cerradas)
+     */
+    int avanzar();
+};
+
+/**
+ * @class MotorRepeticion
+ * @brief Vuelve a jugar un historial grabado y verifica cada evento
+ *
+ * Cada sesión se reconstruye con un Crupier sembrado con la semilla del
+ * historial. Las cartas se vuelven a repartir del zapato real, las manos se
+ * vuelven a sumar con Mano y los resultados y pagos se recalculan con
+ * Reglas y la variante del último evento REGLAS, sin ninguna salida de
+ * texto. Una sesión sin evento REGLAS usa las reglas por defecto de la
+ * consola (S17, DAS, rendición, 4 manos y 3:2). Se sigue cada mano de un
+ * asiento que dobla, divide o se rinde, y hay una liquidación por mano del
+ * titular y una por cada posición que apuesta detrás, con el resultado de la
+ * primera mano y su propia apuesta. La repetición se detiene en la primera discrepancia: carta distinta, carta
+ * pedida sin decisión, decisión imposible o que la variante no permite,
+ * seguro distinto de media apuesta, crupier que no respeta su regla,
+ * barajado antes del corte o liquidación distinta.
+ */
+class MotorRepeticion {
+private:
+    unique_ptr<SalidaJuego> salidaNula;   ///< Descarta la salida del crupier
+    unique_ptr<Crupier> crupier;          ///< Crupier de la sesión actual
+    vector<AsientoRepeticion> asientos;   ///< Manos y apuestas por asiento
+    ConfiguracionReglas reglas;           ///< Variante vigente en la sesión
+    bool crupierVerificado;               ///< Regla del crupier ya verificada en la ronda
+
+    /**
+     * @brief Prepara el estado para una sesión nueva
+     * @param evento Evento INICIO_SESION
+     */
+    void iniciarSesion(const EventoHistorial& evento);
+
+    /**
+     * @brief Limpia las manos y apuestas para una ronda nueva
+     */
+    void iniciarRonda();
+
+    /**
+     * @brief Obtiene un asiento, creándolo si hace falta
+     * @param asiento Asiento del jugador
+     * @return Referencia al asiento
+     */
+    AsientoRepeticion& asientoEn(uint8_t asiento);
+
+    /**
+     * @brief Aplica una decisión a la mano activa de un asiento
+     * @param asiento Asiento del jugador
+     * @param accion Acción registrada
+     * @param reglas Variante vigente
+     * @return nullptr si la decisión es posible, descripción del error si no
+     */
+    static const char* decidir(AsientoRepeticion& asiento, Accion accion, const ConfiguracionReglas& reglas);
+
+    /**
+     * @brief Procesa un evento
+     * @param evento Evento a verificar
+     * @param resultado Resultado acumulado
+     * @return nullptr si el evento coincide, descripción del error si no
+     */
+    const char* procesar(const EventoHistorial& evento, ResultadoRepeticion& resultado);
+
+public:
+    /**
+     * @brief Constructor de la clase MotorRepeticion
+     */
+    MotorRepeticion();
+
+    /**
+     * @brief Repite y verifica un rango de eventos
+     * @param inicio Primer evento
+     * @param fin Final del rango
+     * @return Resultado de la verificación
+     */
+    ResultadoRepeticion repetir(LectorHistorial::Iterador inicio, LectorHistorial::Iterador fin);
+
+    /**
+     * @brief Repite y verifica un historial completo
+     * @param lector Historial abierto
+     * @return Resultado de la verificación
+     */
+    ResultadoRepeticion repetir(const LectorHistorial& lector);
+};
+
+#endif // MOTOR_REPETICION_H
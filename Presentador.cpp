@@ -0,0 +1,77 @@
+#include "Presentador.h"
+#include <algorithm>
+#include <thread>
+using namespace std;
+
+/**
+ * Constructor que configura el ritmo y el flujo de salida
+ */
+Presentador::Presentador(ModoRitmo modo, chrono::milliseconds retardo, ostream& salida)
+    : salida(salida), modo(modo), retardo(retardo), siguienteInstante() {}
+
+/**
+ * Cambia el modo y el retardo
+ */
+void Presentador::configurar(ModoRitmo modo, chrono::milliseconds retardo) {
+    this->modo = modo;
+    this->retardo = retardo;
+}
+
+/**
+ * Programa una línea con el reloj actual
+ */
+void Presentador::programar(const string& linea, bool esAnimacion) {
+    programar(linea, esAnimacion, Reloj::now());
+}
+
+/**
+ * Asigna a la línea el primer instante libre y reserva la pausa posterior
+ */
+void Presentador::programar(const string& linea, bool esAnimacion, Reloj::time_point ahora) {
+    siguienteInstante = max(siguienteInstante, ahora);
+    pendientes.push_back({linea, siguienteInstante});
+
+    if (modo == ModoRitmo::FIJO || (modo == ModoRitmo::SOLO_ANIMACION && esAnimacion)) {
+        siguienteInstante += retardo;
+    }
+}
+
+/**
+ * Escribe las líneas vencidas y se detiene en la primera futura
+ */
+size_t Presentador::emitirPendientes(Reloj::time_point ahora) {
+    size_t emitidas = 0;
+    while (!pendientes.empty() && pendientes.front().instante <= ahora) {
+        salida << pendientes.front().texto << '\n';
+        pendientes.pop_front();
+        emitidas++;
+    }
+    if (emitidas > 0) {
+        salida.flush();
+    }
+    return emitidas;
+}
+
+/**
+ * Espera hasta el instante de cada línea y la escribe
+ */
+void Presentador::drenar() {
+    while (!pendientes.empty()) {
+        this_thread::sleep_until(pendientes.front().instante);
+        emitirPendientes(Reloj::now());
+    }
+}
+
+/**
+ * Instante de la primera línea pendiente
+ */
+Presentador::Reloj::time_point Presentador::proximoInstante() const {
+    return pendientes.empty() ? Reloj::time_point::max() : pendientes.front().instante;
+}
+
+/**
+ * Getter del número de líneas pendientes
+ */
+size_t Presentador::lineasPendientes() const {
+    return pendientes.size();
+}
@@ -0,0 +1,113 @@
+#ifndef PRESENTADOR_H
+#define PRESENTADOR_H
+
+#include "SalidaJuego.h"
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <string>
+using namespace std;
+
+/**
+ * @enum ModoRitmo
+ * @brief Forma en que el presentador espacia las líneas en el tiempo
+ */
+enum class ModoRitmo {
+    SIN_RETARDO,     ///< Todas las líneas son visibles de inmediato
+    FIJO,            ///< Retardo fijo después de cada línea
+    SOLO_ANIMACION   ///< Retardo solo después de las líneas de animación
+};
+
+/**
+ * @class Presentador
+ * @brief Capa de presentación que controla el ritmo de la salida del juego
+ *
+ * La lógica del juego programa líneas y termina de inmediato; cada línea
+ * recibe un instante de salida calculado a partir del modo de ritmo. Quien
+ * muestra el juego decide cuándo emitir las líneas pendientes: sin
+ * bloquear (emitirPendientes) o esperando hasta su instante (drenar).
+ */
+class Presentador {
+public:
+    using Reloj = chrono::steady_clock;
+
+private:
+    /**
+     * @brief Línea pendiente y el instante a partir del cual se muestra
+     */
+    struct LineaProgramada {
+        string texto;
+        Reloj::time_point instante;
+    };
+
+    ostream& salida;                    ///< Flujo donde se escriben las líneas
+    ModoRitmo modo;                     ///< Modo de ritmo actual
+    chrono::milliseconds retardo;       ///< Retardo entre líneas
+    deque<LineaProgramada> pendientes;  ///< Líneas aún no emitidas, en orden
+    Reloj::time_point siguienteInstante;///< Primer instante libre para otra línea
+
+public:
+    /**
+     * @brief Constructor de la clase Presentador
+     * @param modo Modo de ritmo
+     * @param retardo Retardo usado por los modos FIJO y SOLO_ANIMACION
+     * @param salida Flujo de salida
+     */
+    explicit Presentador(ModoRitmo modo = ModoRitmo::SIN_RETARDO,
+                         chrono::milliseconds retardo = chrono::milliseconds(1000),
+                         ostream& salida = SalidaJuego::consola());
+
+    /**
+     * @brief Cambia el modo de ritmo
+     * @param modo Nuevo modo
+     * @param retardo Nuevo retardo entre líneas
+     * @post Afecta solo a las líneas programadas a partir de ahora
+     */
+    void configurar(ModoRitmo modo, chrono::milliseconds retardo);
+
+    /**
+     * @brief Programa una línea usando el reloj actual
+     * @param linea Texto a mostrar (sin salto de línea final)
+     * @param esAnimacion true si la línea debe ir seguida de una pausa
+     *        en el modo SOLO_ANIMACION
+     */
+    void programar(const string& linea, bool esAnimacion = false);
+
+    /**
+     * @brief Programa una línea a partir de un instante dado
+     * @param linea Texto a mostrar
+     * @param esAnimacion true si la línea debe ir seguida de una pausa
+     * @param ahora Instante actual
+     */
+    void programar(const string& linea, bool esAnimacion, Reloj::time_point ahora);
+
+    /**
+     * @brief Escribe las líneas cuyo instante ya llegó, sin esperar
+     * @param ahora Instante actual
+     * @return Número de líneas escritas
+     */
+    size_t emitirPendientes(Reloj::time_point ahora);
+
+    /**
+     * @brief Escribe todas las líneas pendientes respetando sus instantes
+     * @post No quedan líneas pendientes
+     *
+     * Solo debe usarse desde la interfaz de consola: es el único punto
+     * donde el presentador espera.
+     */
+    void drenar();
+
+    /**
+     * @brief Instante de la próxima línea pendiente
+     * @return Instante de salida, o Reloj::time_point::max() si no hay
+     */
+    Reloj::time_point proximoInstante() const;
+
+    /**
+     * @brief Obtiene el número de líneas pendientes
+     * @return Líneas programadas aún no emitidas
+     */
+    size_t lineasPendientes() const;
+};
+
+#endif // PRESENTADOR_H
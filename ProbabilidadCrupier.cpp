@@ -0,0 +1,101 @@
+#include "ProbabilidadCrupier.h"
+#include "Reglas.h"
+using namespace std;
+
+/**
+ * Empaqueta la composición: valores A-9 en 6 bits cada uno y los dieces en 8
+ */
+uint64_t ClaveComposicion::empaquetar(const Composicion& composicion) {
+    uint64_t clave = 0;
+    for (int valor = 0; valor < Carta::NUM_VALORES - 1; valor++) {
+        clave |= static_cast<uint64_t>(composicion[valor] & 0x3F) << (6 * valor);
+    }
+    return clave | static_cast<uint64_t>(composicion[Carta::NUM_VALORES - 1] & 0xFF) << 54;
+}
+
+/**
+ * Constructor que toma la regla del crupier de la variante
+ */
+ProbabilidadCrupier::ProbabilidadCrupier(const ConfiguracionReglas& reglas)
+    : pideCrupier(&reglas.tablaCrupier()), revisaBlackjack(reglas.crupierRevisaBlackjack) {}
+
+/**
+ * Distribución a partir de la carta visible
+ * Solo se memoriza la raíz: recorrer el árbol del crupier (unos pocos miles
+ * de secuencias) es más barato que memorizar cada nodo intermedio
+ */
+DistribucionCrupier ProbabilidadCrupier::calcular(int indiceValorVisible, const Composicion& restantes) {
+    ClaveComposicion clave{ClaveComposicion::empaquetar(restantes), static_cast<uint16_t>(indiceValorVisible)};
+    auto encontrado = memo.find(clave);
+    if (encontrado != memo.end()) {
+        return encontrado->second;
+    }
+
+    Composicion copia = restantes;
+    int totalCartas = 0;
+    for (uint16_t cantidad : copia) {
+        totalCartas += cantidad;
+    }
+
+    DistribucionCrupier distribucion;
+    uint8_t estado = EstadoMano::siguiente(EstadoMano::VACIA, static_cast<uint8_t>(indiceValorVisible));
+    explorar(copia, totalCartas, estado, 1.0, distribucion);
+
+    // Con revisión se descartan las secuencias con Blackjack y el resto se
+    // renormaliza; si el Blackjack es seguro no hay nada que condicionar
+    double sinBlackjack = 1.0 - distribucion.probabilidadBlackjack();
+    if (revisaBlackjack && sinBlackjack > 0.0) {
+        for (double& probabilidad : distribucion.probabilidades) {
+            probabilidad /= sinBlackjack;
+        }
+        distribucion.probabilidades[DistribucionCrupier::BLACKJACK] = 0.0;
+    }
+    memo.emplace(clave, distribucion);
+    return distribucion;
+}
+
+/**
+ * Recorre las secuencias de cartas del crupier acumulando la probabilidad
+ * de cada una en su total final
+ * Cada carta posible se quita del zapato, se explora y se devuelve; el
+ * estado avanza con la tabla de transiciones (índice de valor = rango)
+ */
+void ProbabilidadCrupier::explorar(Composicion& restantes, int totalCartas, uint8_t estado, double probabilidad,
+                                   DistribucionCrupier& distribucion) {
+    if (estado == EstadoMano::BLACKJACK) {
+        distribucion.probabilidades[DistribucionCrupier::BLACKJACK] += probabilidad;
+        return;
+    }
+    if (EstadoMano::sePaso(estado)) {
+        distribucion.probabilidades[DistribucionCrupier::PASADO] += probabilidad;
+        return;
+    }
+    if (!(*pideCrupier)[estado]) {
+        distribucion.probabilidades[EstadoMano::valor(estado) - Reglas::PLANTARSE_CRUPIER] += probabilidad;
+        return;
+    }
+
+    for (int indice = 0; indice < Carta::NUM_VALORES && totalCartas > 0; indice++) {
+        if (restantes[indice] == 0) continue;
+
+        double probabilidadCarta = probabilidad * restantes[indice] / totalCartas;
+        restantes[indice]--;
+        explorar(restantes, totalCartas - 1, EstadoMano::siguiente(estado, static_cast<uint8_t>(indice)),
+                 probabilidadCarta, distribucion);
+        restantes[indice]++;
+    }
+}
+
+/**
+ * Vacía la memoria de estados
+ */
+void ProbabilidadCrupier::limpiarCache() {
+    memo.clear();
+}
+
+/**
+ * Getter del número de estados memorizados
+ */
+size_t ProbabilidadCrupier::tamanoCache() const {
+    return memo.size();
+}
@@ -0,0 +1,141 @@
+#ifndef PROBABILIDAD_CRUPIER_H
+#define PROBABILIDAD_CRUPIER_H
+
+#include "ConjuntoReglas.h"
+#include "Mazo.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+using namespace std;
+
+/**
+ * @struct DistribucionCrupier
+ * @brief Probabilidad de cada total final del crupier
+ */
+struct DistribucionCrupier {
+    static constexpr int PASADO = 5;     ///< Índice de la probabilidad de pasarse
+    static constexpr int BLACKJACK = 6;  ///< Índice de la probabilidad de Blackjack
+    static constexpr int NUM_RESULTADOS = 7;
+
+    /// Índices 0-4: totales 17-21 (sin contar Blackjack), 5: pasado, 6: Blackjack
+    array<double, NUM_RESULTADOS> probabilidades{};
+
+    /**
+     * @brief Obtiene la probabilidad de terminar con un total
+     * @param total Total final entre 17 y 21
+     * @return Probabilidad de ese total (sin Blackjack)
+     */
+    double probabilidadTotal(int total) const { return probabilidades[total - 17]; }
+
+    /**
+     * @brief Obtiene la probabilidad de que el crupier se pase
+     * @return Probabilidad de pasarse de 21
+     */
+    double probabilidadPasarse() const { return probabilidades[PASADO]; }
+
+    /**
+     * @brief Obtiene la probabilidad de que el crupier tenga Blackjack
+     * @return Probabilidad de Blackjack
+     */
+    double probabilidadBlackjack() const { return probabilidades[BLACKJACK]; }
+};
+
+/**
+ * @struct ClaveComposicion
+ * @brief Clave de memorización: composición empaquetada y estado de una mano
+ */
+struct ClaveComposicion {
+    uint64_t composicion;  ///< 6 bits por valor A-9 y 8 bits para los dieces
+    uint16_t estado;       ///< Estado de la mano, codificado por quien usa la clave
+
+    bool operator==(const ClaveComposicion& otra) const {
+        return composicion == otra.composicion && estado == otra.estado;
+    }
+
+    /**
+     * @brief Empaqueta una composición en 62 bits
+     * @param composicion Composición a empaquetar
+     * @return Composición empaquetada
+     * @pre A lo sumo 63 cartas por valor A-9 y 255 de valor 10
+     */
+    static uint64_t empaquetar(const Composicion& composicion);
+
+    /**
+     * @brief Obtiene lo que vale una carta de un índice en la composición empaquetada
+     * @param indiceValor Índice de valor (0 = As)
+     * @return Cantidad a restar al quitar una carta de ese valor
+     */
+    static constexpr uint64_t unidad(int indiceValor) {
+        return 1ULL << (6 * indiceValor);
+    }
+};
+
+/**
+ * @struct HashClaveComposicion
+ * @brief Función hash para ClaveComposicion
+ */
+struct HashClaveComposicion {
+    size_t operator()(const ClaveComposicion& clave) const {
+        return static_cast<size_t>(clave.composicion * 0x9E3779B97F4A7C15ULL) ^ clave.estado;
+    }
+};
+
+/**
+ * @class ProbabilidadCrupier
+ * @brief Calcula de forma exacta la distribución del total final del crupier
+ *
+ * Recorre todas las secuencias de cartas que puede recibir el crupier a
+ * partir de su carta visible y de la composición exacta del zapato,
+ * aplicando la regla de pedir de la variante (S17 o H17). Si el crupier
+ * revisa su carta oculta, la distribución queda condicionada a que no tenga
+ * Blackjack, que es lo que sabe el jugador al decidir. El resultado de cada
+ * (composición, carta visible) se memoriza, de modo que consultar otra vez
+ * la misma composición cuesta una búsqueda.
+ */
+class ProbabilidadCrupier {
+private:
+    /// Distribuciones ya calculadas; el estado de la clave es la carta visible
+    unordered_map<ClaveComposicion, DistribucionCrupier, HashClaveComposicion> memo;
+    const array<bool, EstadoMano::NUM_ESTADOS>* pideCrupier;  ///< Decisión del crupier por estado
+    bool revisaBlackjack;                                     ///< Condicionar a que no haya Blackjack
+
+    /**
+     * @brief Recorre las secuencias de cartas desde un estado intermedio
+     * @param restantes Composición restante (se modifica y se restaura)
+     * @param totalCartas Número de cartas en restantes
+     * @param estado Estado de la mano del crupier (ver EstadoMano)
+     * @param probabilidad Probabilidad de haber llegado a este estado
+     * @param distribucion Distribución donde se acumulan los totales finales
+     */
+    void explorar(Composicion& restantes, int totalCartas, uint8_t estado, double probabilidad,
+                  DistribucionCrupier& distribucion);
+
+public:
+    /**
+     * @brief Constructor de la clase ProbabilidadCrupier
+     * @param reglas Variante; se usan crupierPideSuave17 y crupierRevisaBlackjack
+     */
+    explicit ProbabilidadCrupier(const ConfiguracionReglas& reglas = ConfiguracionReglas());
+
+    /**
+     * @brief Calcula la distribución final del crupier
+     * @param indiceValorVisible Índice de valor de la carta visible (0 = As)
+     * @param restantes Cartas que quedan en el zapato, sin la carta visible
+     * @return Distribución de totales finales, pasarse y Blackjack; con
+     *         revisión, sin Blackjack salvo que el crupier lo tenga seguro
+     */
+    DistribucionCrupier calcular(int indiceValorVisible, const Composicion& restantes);
+
+    /**
+     * @brief Vacía la memoria de estados calculados
+     */
+    void limpiarCache();
+
+    /**
+     * @brief Obtiene el número de estados memorizados
+     * @return Tamaño de la memoria
+     */
+    size_t tamanoCache() const;
+};
+
+#endif // PROBABILIDAD_CRUPIER_H
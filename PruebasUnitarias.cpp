@@ -1,15 +1,45 @@
 
 #include "Carta.h"
+#include "GeneradorAleatorio.h"
 #include "Mazo.h"
+#include "Conteo.h"
 #include "Mano.h"
+#include "EstadoMano.h"
 #include "Jugador.h"
 #include "JugadorHumano.h"
 #include "Crupier.h"
 #include "ControladorJuego.h"
+#include "Dinero.h"
+#include "Reglas.h"
+#include "ConjuntoReglas.h"
+#include "EstrategiaBasica.h"
+#include "ProbabilidadCrupier.h"
+#include "SolverEV.h"
+#include "Simulador.h"
+#include "SimuladorParalelo.h"
+#include "Presentador.h"
+#include "SalidaJuego.h"
+#include "HistorialBinario.h"
+#include "MotorRepeticion.h"
+#include "Asientos.h"
+#include "Liquidacion.h"
+#include "EvaluadorManos.h"
+#include "ServidorMesas.h"
 #include <iostream>
 #include <cassert>
 #include <memory>
 #include <functional>
+#include <fstream>
+#include <cstdio>
+#include <cmath>
+#include <sstream>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 using namespace std;
 
 /**
@@ -42,6 +72,139 @@ private:
         pruebasEjecutadas++;
     }
 
+    /**
+     * @brief Graba una sesión automática con el mismo flujo que ControladorJuego
+     * @param ruta Archivo del historial
+     * @param semilla Semilla del zapato
+     * @param rondas Rondas a jugar
+     * @param numJugadores Jugadores en la mesa
+     */
+    static void grabarSesion(const string& ruta, uint64_t semilla, int rondas, int numJugadores) {
+        remove(ruta.c_str());
+        EscritorHistorial historial;
+        historial.abrir(ruta);
+        auto nula = SalidaJuego::crear(ModoSalida::NULA);
+        Crupier crupier(2);
+        crupier.establecerSalida(nula.get());
+        crupier.sembrar(semilla);
+        historial.registrarInicioSesion(semilla, 2, crupier.obtenerMazo().obtenerPosicionCorte());
+        crupier.establecerHistorial(&historial);
+
+        EstrategiaBasica estrategia;
+        vector<Jugador> jugadores(numJugadores, Jugador("J", Dinero::desdeDolares(1000000000)));
+        for (int ronda = 1; ronda <= rondas; ronda++) {
+            historial.registrarInicioRonda(ronda);
+            crupier.reiniciarMano();
+            crupier.barajarSiAlcanzoCorte();
+            for (int a = 0; a < numJugadores; a++) {
+                jugadores[a].reiniciarMano();
+                jugadores[a].apostar(1000);
+                historial.registrarApuesta(a, 1000);
+            }
+            for (int a = 0; a < numJugadores; a++) {
+                crupier.repartirCartasIniciales(&jugadores[a], a);
+            }
+            crupier.repartirCartasIniciales(&crupier);
+            Carta visible = crupier.obtenerMano().obtenerCartas()[0];
+
+            bool hayManosEnJuego = false;
+            for (int a = 0; a < numJugadores; a++) {
+                Jugador& jugador = jugadores[a];
+                while (!jugador.obtenerMano().esBlackjack() && !jugador.obtenerMano().sePaso()) {
+                    bool pide = estrategia.decidir(jugador.obtenerMano(), visible, false) == Accion::PEDIR;
+                    historial.registrarDecision(a, pide ? Accion::PEDIR : Accion::PLANTARSE);
+                    if (!pide) break;
+                    jugador.recibirCarta(crupier.repartirCarta(a));
+                }
+                hayManosEnJuego |= !jugador.obtenerMano().sePaso();
+            }
+            if (hayManosEnJuego) {
+                crupier.jugarTurno();
+            }
+            for (int a = 0; a < numJugadores; a++) {
+                int resultado = crupier.determinarGanador(&jugadores[a]);
+                historial.registrarLiquidacion(a, resultado, jugadores[a].obtenerMano().calcularValor(),
+                                               crupier.obtenerMano().calcularValor(),
+                                               Reglas::calcularRetorno(resultado, jugadores[a].obtenerMano().esBlackjack(), 1000));
+            }
+        }
+    }
+
+    /**
+     * @brief Conecta un cliente al socket UNIX del servidor
+     * @param ruta Ruta del socket
+     * @return Descriptor conectado, o -1 si falla
+     */
+    static int conectarUnix(const string& ruta) {
+        int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un direccion{};
+        direccion.sun_family = AF_UNIX;
+        strncpy(direccion.sun_path, ruta.c_str(), sizeof(direccion.sun_path) - 1);
+        if (connect(descriptor, reinterpret_cast<sockaddr*>(&direccion), sizeof(direccion)) != 0) {
+            close(descriptor);
+            return -1;
+        }
+        return descriptor;
+    }
+
+    /**
+     * @brief Lee del socket hasta recibir el texto buscado o agotar el plazo
+     * @param descriptor Socket conectado
+     * @param buscado Texto esperado
+     * @return Todo lo recibido
+     */
+    static string leerHasta(int descriptor, const string& buscado) {
+        string recibido;
+        auto limite = chrono::steady_clock::now() + chrono::seconds(5);
+        while (recibido.find(buscado) == string::npos && chrono::steady_clock::now() < limite) {
+            pollfd espera{descriptor, POLLIN, 0};
+            if (poll(&espera, 1, 100) <= 0) continue;
+            char buffer[1024];
+            ssize_t n = recv(descriptor, buffer, sizeof(buffer), 0);
+            if (n <= 0) break;
+            recibido.append(buffer, static_cast<size_t>(n));
+        }
+        return recibido;
+    }
+
+    /**
+     * @brief Lee la siguiente línea del socket
+     * @param descriptor Socket conectado
+     * @param pendiente Bytes recibidos que aún no forman una línea devuelta
+     * @return La línea sin el salto, o vacía si se agota el plazo o se cierra
+     */
+    static string leerLinea(int descriptor, string& pendiente) {
+        auto limite = chrono::steady_clock::now() + chrono::seconds(5);
+        size_t fin;
+        while ((fin = pendiente.find('\n')) == string::npos && chrono::steady_clock::now() < limite) {
+            pollfd espera{descriptor, POLLIN, 0};
+            if (poll(&espera, 1, 100) <= 0) continue;
+            char buffer[1024];
+            ssize_t n = recv(descriptor, buffer, sizeof(buffer), 0);
+            if (n <= 0) break;
+            pendiente.append(buffer, static_cast<size_t>(n));
+        }
+        if (fin == string::npos) return "";
+        string linea = pendiente.substr(0, fin);
+        pendiente.erase(0, fin + 1);
+        return linea;
+    }
+
+    /**
+     * @brief Descarta líneas hasta la primera que empiece por el prefijo
+     * @param descriptor Socket conectado
+     * @param pendiente Bytes recibidos que aún no forman una línea devuelta
+     * @param prefijo Comienzo de la línea buscada
+     * @return La línea encontrada, o vacía si no llega
+     */
+    static string esperarLinea(int descriptor, string& pendiente, const string& prefijo) {
+        string linea;
+        do {
+            linea = leerLinea(descriptor, pendiente);
+        } while (!linea.empty() && linea.rfind(prefijo, 0) != 0);
+        return linea;
+    }
+
     /**
      * @brief Pruebas para la clase Carta
      */
@@ -80,6 +243,22 @@ private:
             Carta carta("Q", "Diamantes");
             assert(carta.toString() == "Q de Diamantes");
         });
+
+        ejecutarPrueba("Codificación compacta de Carta", []() {
+            static_assert(sizeof(Carta) == 1, "La carta debe ocupar un byte");
+            Carta diez(9, 3);
+            assert(diez.obtenerValor() == "10");
+            assert(diez.obtenerPalo() == "Picas");
+            assert(diez.obtenerValorNumerico() == 10);
+            assert(Carta("10", "Picas") == diez);
+        });
+
+        ejecutarPrueba("Carta inválida", []() {
+            Carta invalida("Z", "Corazones");
+            assert(!invalida.esValida());
+            assert(!Carta().esValida());
+            assert(invalida.obtenerValorNumerico() == 0);
+        });
     }
 
     /**
@@ -97,7 +276,7 @@ private:
         ejecutarPrueba("Repartir carta", []() {
             Mazo mazo;
             auto carta = mazo.repartirCarta();
-            assert(carta != nullptr);
+            assert(carta.esValida());
             assert(mazo.cartasRestantes() == 51);
         });
 
@@ -107,6 +286,122 @@ private:
             mazo.reiniciar();
             assert(mazo.cartasRestantes() == 52);
         });
+
+        ejecutarPrueba("Zapato de 8 barajas", []() {
+            Mazo zapato(8, 0.75);
+            assert(zapato.cartasRestantes() == 416);
+            assert(zapato.obtenerNumBarajas() == 8);
+            int ases = 0;
+            while (!zapato.estaVacio()) {
+                if (zapato.repartirCarta().esAs()) ases++;
+            }
+            assert(ases == 32);
+        });
+
+        ejecutarPrueba("Reiniciar conserva la composición", []() {
+            Mazo zapato(2);
+            for (int i = 0; i < 80; i++) zapato.repartirCarta();
+            zapato.reiniciar();
+            int conteo[Carta::NUM_RANGOS] = {0};
+            while (!zapato.estaVacio()) {
+                conteo[zapato.repartirCarta().obtenerRango()]++;
+            }
+            for (int rango = 0; rango < Carta::NUM_RANGOS; rango++) {
+                assert(conteo[rango] == 8);
+            }
+        });
+
+        ejecutarPrueba("Carta de corte según penetración", []() {
+            Mazo zapato(6, 0.5);
+            for (int i = 0; i < 155; i++) zapato.repartirCarta();
+            assert(!zapato.alcanzoCorte());
+            zapato.repartirCarta();
+            assert(zapato.alcanzoCorte());
+            zapato.reiniciar();
+            assert(!zapato.alcanzoCorte());
+            assert(zapato.cartasRestantes() == 312);
+        });
+    }
+
+    /**
+     * @brief Pruebas para los generadores aleatorios
+     */
+    void pruebasGeneradorAleatorio() {
+        cout << "\n--- PRUEBAS GENERADOR ALEATORIO ---" << endl;
+
+        ejecutarPrueba("Misma semilla, misma secuencia", []() {
+            Xoshiro256EstrellaEstrella a(42), b(42);
+            Pcg32 c(42), d(42);
+            for (int i = 0; i < 100; i++) {
+                assert(a.siguiente() == b.siguiente());
+                assert(c.siguiente() == d.siguiente());
+            }
+        });
+
+        ejecutarPrueba("Índices de Fisher-Yates en rango", []() {
+            Pcg32 generador(7);
+            uint32_t indices[416];
+            generador.generarIndicesBarajado(indices, 416);
+            for (uint32_t i = 0; i < 416; i++) {
+                assert(indices[i] <= i);
+            }
+        });
+
+        ejecutarPrueba("Zapatos sembrados son idénticos", []() {
+            Mazo a(6), b(6);
+            a.sembrar(2024);
+            b.repartirCarta();
+            b.sembrar(2024);
+            while (!a.estaVacio()) {
+                assert(a.repartirCarta() == b.repartirCarta());
+            }
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Conteo y las cuentas del zapato
+     */
+    void pruebasConteo() {
+        cout << "\n--- PRUEBAS CLASE CONTEO ---" << endl;
+
+        ejecutarPrueba("Cuentas incrementales iguales al recálculo", []() {
+            Mazo zapato(6, 1.0);
+            zapato.sembrar(23);
+            Conteo::Cuentas esperadas = Conteo::cuentasIniciales(6);
+            while (!zapato.estaVacio()) {
+                Carta carta = zapato.repartirCarta();
+                for (int sistema = 0; sistema < Conteo::NUM_SISTEMAS; sistema++) {
+                    esperadas[sistema] += Conteo::ETIQUETAS[carta.obtenerIndiceValor()][sistema];
+                    assert(zapato.cuentaCorriente(static_cast<SistemaConteo>(sistema)) == esperadas[sistema]);
+                }
+            }
+        });
+
+        ejecutarPrueba("Zapato completo: balanceados a 0 y KO a +4", []() {
+            Mazo zapato(8, 1.0);
+            assert(zapato.cuentaCorriente(SistemaConteo::KO) == -28);
+            while (!zapato.estaVacio()) {
+                zapato.repartirCarta();
+            }
+            assert(zapato.cuentaCorriente(SistemaConteo::HI_LO) == 0);
+            assert(zapato.cuentaCorriente(SistemaConteo::HI_OPT_II) == 0);
+            assert(zapato.cuentaCorriente(SistemaConteo::OMEGA_II) == 0);
+            assert(zapato.cuentaCorriente(SistemaConteo::KO) == 4);
+            zapato.reiniciar();
+            assert(zapato.cuentaCorriente(SistemaConteo::KO) == -28);
+        });
+
+        ejecutarPrueba("Cuenta verdadera con las barajas restantes", []() {
+            Mazo zapato(2, 1.0);
+            zapato.sembrar(5);
+            for (int i = 0; i < 52; i++) {
+                zapato.repartirCarta();
+            }
+            assert(zapato.barajasRestantes() == 1.0);
+            int corriente = zapato.cuentaCorriente(SistemaConteo::HI_LO);
+            assert(zapato.cuentaVerdadera(SistemaConteo::HI_LO) == corriente);
+            assert(Conteo::nombre(SistemaConteo::OMEGA_II) == "Omega II");
+        });
     }
 
     /**
@@ -124,27 +419,110 @@ private:
 
         ejecutarPrueba("Agregar carta a mano", []() {
             Mano mano;
-            auto carta = make_shared<Carta>("K", "Picas");
+            Carta carta("K", "Picas");
             mano.agregarCarta(carta);
             assert(mano.calcularValor() == 10);
         });
 
         ejecutarPrueba("Blackjack con As y figura", []() {
             Mano mano;
-            mano.agregarCarta(make_shared<Carta>("A", "Corazones"));
-            mano.agregarCarta(make_shared<Carta>("K", "Picas"));
+            mano.agregarCarta(Carta("A", "Corazones"));
+            mano.agregarCarta(Carta("K", "Picas"));
             assert(mano.esBlackjack());
             assert(mano.calcularValor() == 21);
         });
 
         ejecutarPrueba("Mano que se pasa", []() {
             Mano mano;
-            mano.agregarCarta(make_shared<Carta>("K", "Picas"));
-            mano.agregarCarta(make_shared<Carta>("Q", "Corazones"));
-            mano.agregarCarta(make_shared<Carta>("5", "Diamantes"));
+            mano.agregarCarta(Carta("K", "Picas"));
+            mano.agregarCarta(Carta("Q", "Corazones"));
+            mano.agregarCarta(Carta("5", "Diamantes"));
             assert(mano.sePaso());
             assert(mano.calcularValor() > 21);
         });
+
+        ejecutarPrueba("Mano suave con As", []() {
+            Mano mano;
+            mano.agregarCarta(Carta("A", "Corazones"));
+            mano.agregarCarta(Carta("6", "Picas"));
+            assert(mano.esSuave());
+            assert(mano.calcularValor() == 17);
+            mano.agregarCarta(Carta("9", "Tréboles"));
+            assert(!mano.esSuave());
+            assert(mano.calcularValor() == 16);
+            assert(!mano.esBlackjack());
+        });
+
+        ejecutarPrueba("Limpiar mano reinicia el total", []() {
+            Mano mano;
+            mano.agregarCarta(Carta("A", "Corazones"));
+            mano.agregarCarta(Carta("A", "Picas"));
+            assert(mano.calcularValor() == 12);
+            mano.limpiar();
+            assert(mano.calcularValor() == 0);
+            assert(mano.obtenerNumeroCartas() == 0);
+            assert(!mano.esSuave());
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase EstadoMano
+     */
+    void pruebasEstadoMano() {
+        cout << "\n--- PRUEBAS CLASE ESTADOMANO ---" << endl;
+
+        ejecutarPrueba("Transiciones calculadas en compilación", []() {
+            constexpr uint8_t as = EstadoMano::siguiente(EstadoMano::VACIA, 0);
+            static_assert(EstadoMano::siguiente(as, 12) == EstadoMano::BLACKJACK, "A + K es Blackjack");
+            static_assert(EstadoMano::valor(EstadoMano::siguiente(as, 5)) == 17, "A + 6 vale 17");
+            static_assert(EstadoMano::esSuave(EstadoMano::siguiente(as, 5)), "A + 6 es suave");
+            static_assert(sizeof(TablasEstadoMano) < 1024, "Las tablas caben en un kilobyte");
+            assert(EstadoMano::sePaso(EstadoMano::siguiente(EstadoMano::desdeTotales(20, false, 3), 9)));
+        });
+
+        ejecutarPrueba("Coincide con el cálculo directo en todas las secuencias", []() {
+            // Todas las secuencias de hasta 4 rangos (13^4 manos)
+            for (int n = 0; n <= 4; n++) {
+                int combinaciones = 1;
+                for (int i = 0; i < n; i++) combinaciones *= Carta::NUM_RANGOS;
+                for (int codigo = 0; codigo < combinaciones; codigo++) {
+                    Mano mano;
+                    int duro = 0;
+                    bool tieneAs = false;
+                    for (int i = 0, resto = codigo; i < n; i++, resto /= Carta::NUM_RANGOS) {
+                        Carta carta(static_cast<uint8_t>(resto % Carta::NUM_RANGOS), 0);
+                        mano.agregarCarta(carta);
+                        duro += carta.esAs() ? 1 : carta.obtenerValorNumerico();
+                        tieneAs |= carta.esAs();
+                    }
+                    bool suave = tieneAs && duro <= 11;
+                    assert(mano.calcularValor() == (suave ? duro + 10 : duro));
+                    assert(mano.esSuave() == suave);
+                    assert(mano.sePaso() == (duro > 21));
+                    assert(mano.esBlackjack() == (n == 2 && suave && duro == 11));
+                    assert(mano.obtenerEstado() == EstadoMano::desdeTotales(duro, tieneAs, n));
+                }
+            }
+        });
+
+        ejecutarPrueba("Decisión del crupier por estado", []() {
+            assert(Reglas::crupierDebePedirEnEstado(EstadoMano::desdeTotales(16, false, 3)));
+            assert(!Reglas::crupierDebePedirEnEstado(EstadoMano::desdeTotales(17, false, 3)));
+            assert(!Reglas::crupierDebePedirEnEstado(EstadoMano::desdeTotales(7, true, 2)));  // 17 suave
+            assert(Reglas::crupierDebePedirEnEstado(EstadoMano::desdeTotales(6, true, 2)));   // 16 suave
+            assert(Reglas::crupierDebePedirEnEstado(EstadoMano::desdeTotales(10, false, 1)));
+            assert(!Reglas::crupierDebePedirEnEstado(EstadoMano::BLACKJACK));
+            assert(!Reglas::crupierDebePedirEnEstado(EstadoMano::PASADA_MAXIMA));
+        });
+
+        ejecutarPrueba("Valor exacto tras pasar de 30", []() {
+            Mano mano;
+            for (int i = 0; i < 4; i++) {
+                mano.agregarCarta(Carta("K", "Picas"));
+            }
+            assert(mano.obtenerEstado() == EstadoMano::PASADA_MAXIMA);
+            assert(mano.calcularValor() == 40 && mano.sePaso());
+        });
     }
 
     /**
@@ -154,29 +532,373 @@ private:
         cout << "\n--- PRUEBAS CLASE JUGADOR ---" << endl;
 
         ejecutarPrueba("Constructor de Jugador", []() {
-            JugadorHumano jugador("Test", 100.0);
+            JugadorHumano jugador("Test", 10000);
             assert(jugador.obtenerNombre() == "Test");
-            assert(jugador.obtenerDinero() == 100.0);
-            assert(jugador.obtenerApuestaActual() == 0.0);
+            assert(jugador.obtenerDinero() == 10000);
+            assert(jugador.obtenerApuestaActual() == 0);
         });
 
         ejecutarPrueba("Realizar apuesta válida", []() {
-            JugadorHumano jugador("Test", 100.0);
-            assert(jugador.apostar(50.0) == true);
-            assert(jugador.obtenerDinero() == 50.0);
-            assert(jugador.obtenerApuestaActual() == 50.0);
+            JugadorHumano jugador("Test", 10000);
+            assert(jugador.apostar(5000) == true);
+            assert(jugador.obtenerDinero() == 5000);
+            assert(jugador.obtenerApuestaActual() == 5000);
         });
 
         ejecutarPrueba("Apuesta inválida", []() {
-            JugadorHumano jugador("Test", 100.0);
-            assert(jugador.apostar(150.0) == false);
-            assert(jugador.obtenerDinero() == 100.0);
+            JugadorHumano jugador("Test", 10000);
+            assert(jugador.apostar(15000) == false);
+            assert(jugador.obtenerDinero() == 10000);
         });
 
         ejecutarPrueba("Ganar dinero", []() {
-            JugadorHumano jugador("Test", 100.0);
-            jugador.ganar(50.0);
-            assert(jugador.obtenerDinero() == 150.0);
+            JugadorHumano jugador("Test", 10000);
+            jugador.ganar(5000);
+            assert(jugador.obtenerDinero() == 15000);
+        });
+
+        ejecutarPrueba("Interpretar la decisión sobre una mano", []() {
+            assert(JugadorHumano::interpretarDecision("s") == Accion::PEDIR);
+            assert(JugadorHumano::interpretarDecision(" D") == Accion::DOBLAR);
+            assert(JugadorHumano::interpretarDecision("v") == Accion::DIVIDIR);
+            assert(JugadorHumano::interpretarDecision("R") == Accion::RENDIRSE);
+            assert(JugadorHumano::interpretarDecision("n") == Accion::PLANTARSE);
+            assert(JugadorHumano::interpretarDecision("") == Accion::PLANTARSE);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Asientos
+     */
+    void pruebasAsientos() {
+        cout << "\n--- PRUEBAS CLASE ASIENTOS ---" << endl;
+
+        ejecutarPrueba("Sentar titulares y apuestas detrás", []() {
+            Asientos asientos(3);
+            assert(asientos.sentar("Ana", 10000) == 0);
+            assert(asientos.sentar("Luis", 10000) == 1);
+            assert(asientos.agregarDetras(2, "Eva", 10000) == -1);  // Asiento vacío
+            assert(asientos.sentar("Sol", 10000) == 2);
+            assert(asientos.sentar("Sobra", 10000) == -1);
+            assert(asientos.agregarDetras(1, "Eva", 10000) == 3);
+            assert(asientos.obtenerAsiento(3) == 1);
+            assert(!asientos.esTitular(3));
+            assert(asientos.esTitular(1));
+            assert(asientos.numPosiciones() == 4);
+        });
+
+        ejecutarPrueba("La apuesta detrás requiere al titular", []() {
+            Asientos asientos(2);
+            asientos.sentar("Ana", 10000);
+            int detras = asientos.agregarDetras(0, "Eva", 5000);
+            assert(!asientos.apostar(detras, 1000));
+            assert(!asientos.apostar(0, 50000));
+            assert(asientos.obtenerEstado(0) == EstadoAsiento::SIN_APUESTA);
+            assert(asientos.apostar(0, 1000));
+            assert(asientos.obtenerEstado(0) == EstadoAsiento::JUGANDO);
+            assert(asientos.apostar(detras, 2000));
+            assert(asientos.obtenerDineros()[detras] == 3000);
+            assert(asientos.obtenerApuestas()[0] == 1000);
+        });
+
+        ejecutarPrueba("Estado de la mano carta a carta", []() {
+            Asientos asientos(2);
+            asientos.sentar("Ana", 10000);
+            asientos.sentar("Luis", 10000);
+            asientos.apostar(0, 1000);
+            asientos.apostar(1, 1000);
+            asientos.recibirCarta(0, Carta("A", "Picas"));
+            asientos.recibirCarta(0, Carta("K", "Picas"));
+            assert(asientos.obtenerEstado(0) == EstadoAsiento::BLACKJACK);
+            assert(asientos.obtenerTotal(0) == 21 && asientos.esSuave(0));
+
+            asientos.recibirCarta(1, Carta("10", "Picas"));
+            asientos.recibirCarta(1, Carta("6", "Picas"));
+            assert(asientos.obtenerEstado(1) == EstadoAsiento::JUGANDO);
+            asientos.recibirCarta(1, Carta("K", "Picas"));
+            assert(asientos.obtenerEstado(1) == EstadoAsiento::PASADO);
+            assert(asientos.obtenerTotales()[1] == 26);
+
+            asientos.reiniciarRonda();
+            assert(asientos.obtenerEstado(1) == EstadoAsiento::SIN_APUESTA);
+            assert(asientos.obtenerApuesta(0) == 0);
+            assert(asientos.obtenerMano(0).obtenerNumeroCartas() == 0);
+        });
+
+        ejecutarPrueba("Dividir y doblar en la reserva de manos", []() {
+            Asientos asientos(3);
+            asientos.sentar("Ana", 3000);
+            asientos.sentar("Luis", 10000);
+            asientos.apostar(0, 1000);
+            asientos.apostar(1, 1000);
+            asientos.recibirCarta(0, Carta("8", "Picas"));
+            asientos.recibirCarta(0, Carta("8", "Corazones"));
+            asientos.recibirCarta(1, Carta("K", "Picas"));
+            asientos.recibirCarta(1, Carta("K", "Corazones"));
+
+            assert(asientos.dividir(0, 0));
+            assert(asientos.numManos(0) == 2 && asientos.indiceMano(0, 1) == 3);
+            assert(asientos.obtenerMano(0, 1).obtenerNumeroCartas() == 1);
+            assert(asientos.obtenerAsientosMano()[3] == 0 && asientos.obtenerApuestaMano(0, 1) == 1000);
+            assert(asientos.obtenerDinero(0) == 1000);
+            assert(!asientos.rendirse(0));
+
+            // Ana vuelve a dividir antes de que juegue Luis; Luis ya no deja hueco en medio
+            asientos.recibirCarta(0, Carta("8", "Diamantes"), 0);
+            assert(asientos.dividir(0, 0));
+            assert(asientos.indiceMano(0, 2) == 4 && asientos.obtenerDinero(0) == 0);
+            assert(asientos.dividir(1, 0) && asientos.indiceMano(1, 1) == 5);
+            assert(asientos.numManosEnUso() == 6);
+
+            asientos.recibirCarta(1, Carta("2", "Picas"), 0);
+            assert(asientos.doblar(1, 0));
+            assert(asientos.obtenerApuesta(1) == 2000 && asientos.obtenerApuestaMano(1, 1) == 1000);
+            assert(asientos.obtenerDinero(1) == 7000);
+            asientos.recibirCarta(1, Carta("A", "Picas"), 1);
+            assert(asientos.obtenerEstado(1, 1) == EstadoAsiento::PLANTADO);  // 21 dividido, no Blackjack
+
+            asientos.reiniciarRonda();
+            assert(asientos.numManos(0) == 1 && asientos.numManosEnUso() == 3);
+            assert(asientos.obtenerEstados()[4] == EstadoAsiento::VACIO);
+        });
+
+        ejecutarPrueba("Rendición y seguro", []() {
+            Asientos asientos(2);
+            asientos.sentar("Ana", 10000);
+            int detras = asientos.agregarDetras(0, "Eva", 10000);
+            asientos.apostar(0, 1000);
+            asientos.apostar(detras, 501);
+            assert(asientos.asegurar(detras) && asientos.obtenerSeguro(detras) == 250);
+            assert(!asientos.asegurar(detras));
+            assert(asientos.obtenerDinero(detras) == 10000 - 501 - 250);
+
+            assert(!asientos.rendirse(0));  // Sin cartas
+            asientos.recibirCarta(0, Carta("10", "Picas"));
+            asientos.recibirCarta(0, Carta("6", "Picas"));
+            assert(asientos.rendirse(0));
+            assert(asientos.obtenerEstado(0) == EstadoAsiento::RENDIDO);
+            assert(!asientos.doblar(0, 0));
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Liquidacion
+     */
+    void pruebasLiquidacion() {
+        cout << "\n--- PRUEBAS CLASE LIQUIDACION ---" << endl;
+
+        ejecutarPrueba("Resultados por asiento", []() {
+            const uint8_t totales[] = {20, 18, 21, 25, 19, 0};
+            const EstadoAsiento estados[] = {EstadoAsiento::PLANTADO, EstadoAsiento::PLANTADO,
+                                             EstadoAsiento::BLACKJACK, EstadoAsiento::PASADO,
+                                             EstadoAsiento::JUGANDO, EstadoAsiento::SIN_APUESTA};
+            int8_t resultados[6];
+            Liquidacion::resolverAsientos(totales, estados, 6, 19, false, resultados);
+            assert(resultados[0] == Liquidacion::GANA);
+            assert(resultados[1] == Liquidacion::PIERDE);
+            assert(resultados[2] == Liquidacion::GANA_BLACKJACK);
+            assert(resultados[3] == Liquidacion::PIERDE);
+            assert(resultados[4] == Liquidacion::EMPATE);
+            assert(resultados[5] == Liquidacion::PIERDE);
+
+            Liquidacion::resolverAsientos(totales, estados, 6, 22, false, resultados);
+            assert(resultados[1] == Liquidacion::GANA && resultados[3] == Liquidacion::PIERDE);
+            Liquidacion::resolverAsientos(totales, estados, 6, 21, true, resultados);
+            assert(resultados[0] == Liquidacion::PIERDE && resultados[2] == Liquidacion::EMPATE);
+        });
+
+        ejecutarPrueba("Retornos por posición", []() {
+            const int8_t resultadosAsiento[] = {Liquidacion::GANA_BLACKJACK, Liquidacion::EMPATE, Liquidacion::PIERDE};
+            const uint8_t asientosPosicion[] = {0, 1, 2, 0, 1};
+            const Centavos apuestas[] = {1000, 2000, 3000, 400, 0};
+            int8_t resultados[5];
+            Centavos retornos[5];
+            Liquidacion::calcularRetornos(resultadosAsiento, asientosPosicion, apuestas, 5, resultados, retornos);
+            assert(retornos[0] == 2500 && retornos[1] == 2000 && retornos[2] == 0);
+            assert(retornos[3] == 1000 && retornos[4] == 0);
+            assert(resultados[3] == Liquidacion::GANA_BLACKJACK);
+        });
+
+        ejecutarPrueba("Coincide con Reglas en manos aleatorias", []() {
+            Mazo zapato(6, 1.0);
+            zapato.sembrar(17);
+            Liquidacion liquidacion;
+            for (int ronda = 0; ronda < 2000; ronda++) {
+                if (zapato.cartasRestantes() < 60) {
+                    zapato.reiniciar();
+                }
+                Asientos asientos(7);
+                for (int asiento = 0; asiento < 7; asiento++) {
+                    asientos.sentar("J", 10000);
+                    asientos.apostar(asiento, 1000);
+                    int objetivo = 12 + ronda % 8;
+                    while (asientos.obtenerEstado(asiento) == EstadoAsiento::JUGANDO &&
+                           (asientos.obtenerMano(asiento).obtenerNumeroCartas() < 2 || asientos.obtenerTotal(asiento) < objetivo)) {
+                        asientos.recibirCarta(asiento, zapato.repartirCarta());
+                    }
+                    asientos.plantar(asiento);
+                }
+                Mano crupier;
+                while (crupier.calcularValor() < 17) {
+                    crupier.agregarCarta(zapato.repartirCarta());
+                }
+
+                liquidacion.liquidar(asientos, crupier);
+                for (int asiento = 0; asiento < 7; asiento++) {
+                    const Mano& mano = asientos.obtenerMano(asiento);
+                    int esperado = Reglas::compararManos(mano, crupier);
+                    int obtenido = liquidacion.obtenerResultados()[asiento];
+                    assert(min(obtenido, 1) == esperado);
+                    assert(liquidacion.obtenerRetornos()[asiento] ==
+                           Reglas::calcularRetorno(esperado, mano.esBlackjack(), 1000));
+                }
+            }
+        });
+
+        ejecutarPrueba("Rendición, manos divididas y seguro", []() {
+            Asientos asientos(3);
+            asientos.sentar("Ana", 10000);
+            asientos.sentar("Luis", 10000);
+            int detras = asientos.agregarDetras(1, "Eva", 10000);
+            asientos.apostar(0, 1001);
+            asientos.apostar(1, 1000);
+            asientos.apostar(detras, 600);
+            asientos.recibirCarta(0, Carta("10", "Picas"));
+            asientos.recibirCarta(0, Carta("6", "Picas"));
+            asientos.rendirse(0);
+            asientos.recibirCarta(1, Carta("9", "Picas"));
+            asientos.recibirCarta(1, Carta("9", "Corazones"));
+            asientos.dividir(1, 0);
+            asientos.recibirCarta(1, Carta("K", "Picas"), 0);   // 19
+            asientos.recibirCarta(1, Carta("9", "Diamantes"), 1);
+            asientos.doblar(1, 1);
+            asientos.recibirCarta(1, Carta("2", "Picas"), 1);   // 20 doblado
+            asientos.plantar(1, 0);
+            asientos.plantar(1, 1);
+            asientos.asegurar(detras);
+
+            Mano crupier;
+            crupier.agregarCarta(Carta("K", "Corazones"));
+            crupier.agregarCarta(Carta("9", "Tréboles"));
+            Liquidacion liquidacion;
+            liquidacion.liquidar(asientos, crupier);
+            assert(liquidacion.obtenerResultados()[0] == Liquidacion::RINDE);
+            assert(liquidacion.obtenerResultadosMano()[asientos.indiceMano(1, 1)] == Liquidacion::GANA);
+            assert(liquidacion.obtenerRetornos()[0] == 500);             // Media apuesta, sin el centavo impar
+            assert(liquidacion.obtenerRetornos()[1] == 1000 + 4000);     // Empate y doble ganado
+            assert(liquidacion.obtenerRetornos()[detras] == 600);        // Sigue la primera mano; pierde el seguro
+
+            crupier.limpiar();
+            crupier.agregarCarta(Carta("A", "Corazones"));
+            crupier.agregarCarta(Carta("K", "Tréboles"));
+            liquidacion.liquidar(asientos, crupier);
+            assert(liquidacion.obtenerRetornos()[detras] == 300 * 3);    // El seguro paga 2:1
+            assert(liquidacion.obtenerRetornos()[0] == 500);
+        });
+
+        ejecutarPrueba("Apuestas máximas dobladas y divididas", []() {
+            const Centavos maxima = Dinero::APUESTA_MAXIMA;
+            Asientos asientos(1);
+            asientos.sentar("Ana", INT64_MAX);
+            asientos.apostar(0, maxima);
+            asientos.recibirCarta(0, Carta("5", "Picas"));
+            asientos.recibirCarta(0, Carta("6", "Picas"));
+            assert(!asientos.doblar(0, 0));         // La mano doblada pasaría del máximo
+            assert(asientos.obtenerApuestaMano(0, 0) == maxima);
+
+            // Cuatro manos máximas ganadas: el pago más alto posible cabe justo
+            asientos.reiniciarRonda();
+            asientos.apostar(0, maxima);
+            asientos.recibirCarta(0, Carta("8", "Picas"));
+            asientos.recibirCarta(0, Carta("8", "Corazones"));
+            for (int division = 0; division < 3; division++) {
+                assert(asientos.dividir(0, 0));
+                asientos.recibirCarta(0, Carta("8", "Tréboles"), 0);
+            }
+            for (int mano = 0; mano < 4; mano++) {
+                if (asientos.obtenerMano(0, mano).obtenerNumeroCartas() == 1) {
+                    asientos.recibirCarta(0, Carta("8", "Diamantes"), mano);
+                }
+                asientos.recibirCarta(0, Carta("3", "Diamantes"), mano);  // 19
+                asientos.plantar(0, mano);
+            }
+            Mano crupier;
+            crupier.agregarCarta(Carta("K", "Corazones"));
+            crupier.agregarCarta(Carta("8", "Tréboles"));
+            Liquidacion liquidacion;
+            assert(liquidacion.liquidar(asientos, crupier));
+            assert(liquidacion.obtenerRetornos()[0] == 8 * maxima);
+            assert(!liquidacion.obtenerDesbordados()[0]);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase EvaluadorManos
+     */
+    void pruebasEvaluadorManos() {
+        cout << "\n--- PRUEBAS CLASE EVALUADORMANOS ---" << endl;
+
+        ejecutarPrueba("Evaluar manos conocidas", []() {
+            vector<Mano> manos(4);
+            manos[0].agregarCarta(Carta("A", "Picas"));
+            manos[0].agregarCarta(Carta("K", "Picas"));
+            manos[1].agregarCarta(Carta("A", "Picas"));
+            manos[1].agregarCarta(Carta("5", "Picas"));
+            manos[1].agregarCarta(Carta("5", "Corazones"));
+            manos[2].agregarCarta(Carta("K", "Picas"));
+            manos[2].agregarCarta(Carta("Q", "Picas"));
+            manos[2].agregarCarta(Carta("2", "Picas"));
+            EvaluadorManos evaluador;
+            assert(evaluador.cargar(manos));
+            evaluador.evaluar();
+            const vector<uint8_t>& totales = evaluador.obtenerTotales();
+            const vector<uint8_t>& banderas = evaluador.obtenerBanderas();
+            assert(totales[0] == 21 && banderas[0] == (EvaluadorManos::SUAVE | EvaluadorManos::BLACKJACK));
+            assert(totales[1] == 21 && banderas[1] == EvaluadorManos::SUAVE);
+            assert(totales[2] == 22 && banderas[2] == EvaluadorManos::PASADA);
+            assert(totales[3] == 0 && banderas[3] == 0);
+        });
+
+        ejecutarPrueba("Ambos núcleos coinciden con Mano", []() {
+            Mazo zapato(6, 1.0);
+            zapato.sembrar(21);
+            vector<Mano> manos(5003);  // No múltiplo de 32: la cola la evalúa el escalar
+            for (size_t i = 0; i < manos.size(); i++) {
+                int cartas = static_cast<int>(i % 9);
+                for (int c = 0; c < cartas; c++) {
+                    if (zapato.estaVacio()) {
+                        zapato.reiniciar();
+                    }
+                    manos[i].agregarCarta(zapato.repartirCarta());
+                }
+            }
+            EvaluadorManos evaluador;
+            assert(evaluador.cargar(manos));
+            const vector<uint8_t>& rangos = evaluador.obtenerRangos();
+            size_t n = manos.size();
+            vector<uint8_t> totales(n), banderas(n), totalesAVX2(n), banderasAVX2(n);
+            EvaluadorManos::evaluarEscalar(rangos.data(), n, n, 8, totales.data(), banderas.data());
+            if (EvaluadorManos::admiteAVX2()) {
+                EvaluadorManos::evaluarAVX2(rangos.data(), n, n, 8, totalesAVX2.data(), banderasAVX2.data());
+                assert(totalesAVX2 == totales && banderasAVX2 == banderas);
+            }
+            for (size_t i = 0; i < n; i++) {
+                const Mano& mano = manos[i];
+                assert(totales[i] == mano.calcularValor());
+                assert(((banderas[i] & EvaluadorManos::SUAVE) != 0) == mano.esSuave());
+                assert(((banderas[i] & EvaluadorManos::PASADA) != 0) == mano.sePaso());
+                assert(((banderas[i] & EvaluadorManos::BLACKJACK) != 0) == mano.esBlackjack());
+            }
+        });
+
+        ejecutarPrueba("Rechaza manos con demasiadas cartas", []() {
+            vector<Mano> manos(1);
+            for (int c = 0; c <= EvaluadorManos::MAX_CARTAS; c++) {
+                manos[0].agregarCarta(Carta("2", "Picas"));
+            }
+            EvaluadorManos evaluador;
+            assert(!evaluador.cargar(manos));
+            assert(evaluador.obtenerNumManos() == 0);
         });
     }
 
@@ -194,9 +916,637 @@ private:
         ejecutarPrueba("Repartir carta", []() {
             Crupier crupier;
             auto carta = crupier.repartirCarta();
-            assert(carta != nullptr);
+            assert(carta.esValida());
             assert(crupier.obtenerCartasRestantes() == 51);
         });
+
+        ejecutarPrueba("Turno del crupier sin esperas", []() {
+            ostringstream salida;
+            Presentador presentador(ModoRitmo::SOLO_ANIMACION, chrono::milliseconds(1000), salida);
+            Crupier crupier(6);
+            crupier.establecerPresentador(&presentador);
+            crupier.recibirCarta(Carta("2", "Picas"));
+            crupier.recibirCarta(Carta("3", "Picas"));
+
+            auto inicio = chrono::steady_clock::now();
+            crupier.jugarTurno();
+            assert(chrono::steady_clock::now() - inicio < chrono::milliseconds(500));
+            assert(crupier.obtenerMano().calcularValor() >= 17);
+            assert(presentador.lineasPendientes() > 0);
+            assert(presentador.proximoInstante() > inicio);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Presentador
+     */
+    void pruebasPresentador() {
+        cout << "\n--- PRUEBAS CLASE PRESENTADOR ---" << endl;
+
+        ejecutarPrueba("Sin retardo emite todo de inmediato", []() {
+            ostringstream salida;
+            Presentador presentador(ModoRitmo::SIN_RETARDO, chrono::milliseconds(1000), salida);
+            auto t0 = Presentador::Reloj::now();
+            presentador.programar("a", true, t0);
+            presentador.programar("b", true, t0);
+            assert(presentador.emitirPendientes(t0) == 2);
+            assert(salida.str() == "a\nb\n");
+        });
+
+        ejecutarPrueba("Solo animación retrasa tras las animaciones", []() {
+            ostringstream salida;
+            Presentador presentador(ModoRitmo::SOLO_ANIMACION, chrono::milliseconds(1000), salida);
+            auto t0 = Presentador::Reloj::now();
+            presentador.programar("a", false, t0);
+            presentador.programar("b", true, t0);
+            presentador.programar("c", false, t0);
+            assert(presentador.emitirPendientes(t0) == 2);
+            assert(presentador.emitirPendientes(t0 + chrono::milliseconds(999)) == 0);
+            assert(presentador.emitirPendientes(t0 + chrono::milliseconds(1000)) == 1);
+            assert(salida.str() == "a\nb\nc\n");
+        });
+
+        ejecutarPrueba("Retardo fijo entre todas las líneas", []() {
+            ostringstream salida;
+            Presentador presentador(ModoRitmo::FIJO, chrono::milliseconds(10), salida);
+            auto t0 = Presentador::Reloj::now();
+            for (int i = 0; i < 3; i++) {
+                presentador.programar("x", false, t0);
+            }
+            assert(presentador.proximoInstante() == t0);
+            assert(presentador.emitirPendientes(t0 + chrono::milliseconds(10)) == 2);
+            presentador.drenar();
+            assert(presentador.lineasPendientes() == 0);
+            assert(presentador.proximoInstante() == Presentador::Reloj::time_point::max());
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase SalidaJuego
+     */
+    void pruebasSalidaJuego() {
+        cout << "\n--- PRUEBAS CLASE SALIDA JUEGO ---" << endl;
+
+        ejecutarPrueba("Salida interactiva escribe de inmediato", []() {
+            ostringstream destino;
+            auto salida = SalidaJuego::crear(ModoSalida::INTERACTIVA, destino);
+            *salida << "Mano: " << 21 << '\n';
+            assert(destino.str() == "Mano: 21\n");
+            assert(salida->obtenerModo() == ModoSalida::INTERACTIVA);
+        });
+
+        ejecutarPrueba("Salida con buffer escribe al vaciar", []() {
+            ostringstream destino;
+            auto salida = SalidaJuego::crear(ModoSalida::BUFFER, destino);
+            *salida << "linea\n";
+            assert(destino.str().empty());
+            salida->flush();
+            assert(destino.str() == "linea\n");
+        });
+
+        ejecutarPrueba("Salida nula descarta todo", []() {
+            ostringstream destino;
+            auto salida = SalidaJuego::crear(ModoSalida::NULA, destino);
+            *salida << "nada " << 3.5 << '\n';
+            salida->flush();
+            assert(destino.str().empty());
+        });
+
+        ejecutarPrueba("Salida asíncrona conserva el orden", []() {
+            ostringstream destino;
+            string esperado;
+            {
+                auto salida = SalidaJuego::crear(ModoSalida::ASINCRONA, destino);
+                for (int i = 0; i < 20000; i++) {
+                    *salida << "Ronda " << i << '\n';
+                    esperado += "Ronda " + to_string(i) + "\n";
+                }
+                salida->flush();
+                assert(destino.str() == esperado);
+                *salida << "fin\n";
+            }
+            assert(destino.str() == esperado + "fin\n");
+        });
+    }
+
+    /**
+     * @brief Pruebas para el historial binario
+     */
+    void pruebasHistorialBinario() {
+        cout << "\n--- PRUEBAS HISTORIAL BINARIO ---" << endl;
+
+        ejecutarPrueba("Escribir y leer eventos", []() {
+            const string ruta = "historial_prueba.bjh";
+            remove(ruta.c_str());
+            {
+                EscritorHistorial escritor;
+                assert(escritor.abrir(ruta));
+                escritor.registrarInicioSesion(0x0123456789ABCDEFULL, 6, 234);
+                escritor.registrarInicioRonda(7);
+                escritor.registrarApuesta(2, 1250);
+                escritor.registrarCarta(EventoHistorial::ASIENTO_CRUPIER, Carta("Q", "Picas"));
+                escritor.registrarDecision(2, Accion::PEDIR);
+                escritor.registrarLiquidacion(2, -1, 22, 19, 0, 3);
+                escritor.registrarBarajado();
+            }
+
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            assert(lector.tamanoBytes() == EscritorHistorial::TAMANO_CABECERA + 12 + 5 + 11 + 3 + 3 + 14 + 1);
+            auto it = lector.begin();
+            assert(it->tipo == TipoEvento::INICIO_SESION && it->semilla == 0x0123456789ABCDEFULL);
+            assert(it->numBarajas == 6 && it->posicionCorte == 234);
+            ++it;
+            assert(it->tipo == TipoEvento::INICIO_RONDA && it->ronda == 7);
+            ++it;
+            assert(it->tipo == TipoEvento::APUESTA && it->asiento == 2 && it->centavos == 1250);
+            assert(it->apostador == 0);
+            ++it;
+            assert(it->tipo == TipoEvento::CARTA && it->carta == Carta("Q", "Picas"));
+            assert(it->asiento == EventoHistorial::ASIENTO_CRUPIER);
+            ++it;
+            assert(it->tipo == TipoEvento::DECISION && it->accion == Accion::PEDIR);
+            ++it;
+            assert(it->tipo == TipoEvento::LIQUIDACION && it->resultado == -1 && it->apostador == 3);
+            assert(it->totalJugador == 22 && it->totalCrupier == 19 && it->centavos == 0);
+            ++it;
+            assert(it->tipo == TipoEvento::BARAJADO);
+            ++it;
+            assert(it == lector.end());
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Registro incompleto termina la lectura", []() {
+            const string ruta = "historial_truncado.bjh";
+            {
+                ofstream archivo(ruta, ios::binary);
+                archivo << "BJH" << char(EscritorHistorial::VERSION);
+                archivo << char(TipoEvento::BARAJADO) << char(TipoEvento::CARTA) << char(0);
+            }
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            int eventos = 0;
+            for (const EventoHistorial& evento : lector) {
+                assert(evento.tipo == TipoEvento::BARAJADO);
+                eventos++;
+            }
+            assert(eventos == 1);
+            lector.cerrar();
+            remove(ruta.c_str());
+            assert(!lector.abrir("no_existe.bjh"));
+        });
+
+        ejecutarPrueba("Un tipo desconocido se entrega y la repetición lo rechaza", []() {
+            const string ruta = "historial_desconocido.bjh";
+            remove(ruta.c_str());
+            {
+                EscritorHistorial escritor;
+                assert(escritor.abrir(ruta));
+                escritor.registrarInicioSesion(7, 1, 40);
+            }
+            {
+                ofstream archivo(ruta, ios::binary | ios::app);
+                archivo << char(0x7F) << char(TipoEvento::BARAJADO);
+            }
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            vector<TipoEvento> tipos;
+            for (const EventoHistorial& evento : lector) {
+                tipos.push_back(evento.tipo);
+            }
+            assert((tipos == vector<TipoEvento>{TipoEvento::INICIO_SESION, TipoEvento::DESCONOCIDO}));
+
+            MotorRepeticion motor;
+            ResultadoRepeticion resultado = motor.repetir(lector);
+            assert(!resultado.correcto);
+            assert(resultado.indiceError == 1);
+            assert(resultado.error == "Tipo de evento desconocido");
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Solo se agrega a un historial de esta versión", []() {
+            const string ruta = "historial_ajeno.bjh";
+            remove(ruta.c_str());
+            {
+                EscritorHistorial escritor;
+                assert(escritor.abrir(ruta));
+                escritor.registrarBarajado();
+            }
+            {
+                EscritorHistorial escritor;
+                assert(escritor.abrir(ruta));  // Misma versión: se agrega
+                escritor.registrarBarajado();
+            }
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            assert(lector.tamanoBytes() == EscritorHistorial::TAMANO_CABECERA + 2);
+            lector.cerrar();
+
+            {
+                ofstream archivo(ruta, ios::binary);
+                archivo << "BJH" << char(EscritorHistorial::VERSION + 1) << char(TipoEvento::BARAJADO);
+            }
+            EscritorHistorial escritor;
+            assert(!escritor.abrir(ruta));
+            assert(!escritor.estaAbierto());
+            // La versión 1 no tenía SEGURO ni REGLAS y liquidaba por asiento
+            {
+                ofstream archivo(ruta, ios::binary);
+                archivo << "BJH" << char(1) << char(TipoEvento::BARAJADO);
+            }
+            assert(!escritor.abrir(ruta));
+            assert(!lector.abrir(ruta));
+            {
+                ofstream archivo(ruta, ios::binary);
+                archivo << "texto";
+            }
+            assert(!escritor.abrir(ruta));
+            assert(ifstream(ruta, ios::binary | ios::ate).tellg() == 5);  // No se tocó
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Crupier registra cartas y barajados", []() {
+            const string ruta = "historial_crupier.bjh";
+            remove(ruta.c_str());
+            Carta repartida;
+            {
+                EscritorHistorial escritor;
+                assert(escritor.abrir(ruta));
+                Crupier crupier;
+                crupier.establecerHistorial(&escritor);
+                repartida = crupier.repartirCarta(3);
+                crupier.reiniciarMazo();
+            }
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            auto it = lector.begin();
+            assert(it->tipo == TipoEvento::CARTA && it->asiento == 3 && it->carta == repartida);
+            ++it;
+            assert(it->tipo == TipoEvento::BARAJADO);
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase MotorRepeticion
+     */
+    void pruebasMotorRepeticion() {
+        cout << "\n--- PRUEBAS CLASE MOTOR REPETICION ---" << endl;
+
+        ejecutarPrueba("Repetir una sesión grabada", []() {
+            const string ruta = "repeticion_prueba.bjh";
+            grabarSesion(ruta, 99, 500, 3);
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            MotorRepeticion motor;
+            ResultadoRepeticion resultado = motor.repetir(lector);
+            assert(resultado.correcto);
+            assert(resultado.sesiones == 1);
+            assert(resultado.rondas == 500);
+            assert(resultado.manos == 1500);
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Detectar un pago alterado", []() {
+            const string ruta = "repeticion_alterada.bjh";
+            grabarSesion(ruta, 7, 20, 1);
+            {
+                // Cambiar el último byte: la parte alta del retorno de la última liquidación
+                fstream archivo(ruta, ios::in | ios::out | ios::binary);
+                archivo.seekp(-1, ios::end);
+                archivo.put(char(0x01));
+            }
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            MotorRepeticion motor;
+            ResultadoRepeticion resultado = motor.repetir(lector);
+            assert(!resultado.correcto);
+            assert(resultado.error == "Pago distinto");
+            assert(resultado.rondas == 20);
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Detectar una carta alterada", []() {
+            const string ruta = "repeticion_carta.bjh";
+            grabarSesion(ruta, 7, 5, 1);
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            size_t desplazamiento = 0;
+            size_t posicion = EscritorHistorial::TAMANO_CABECERA;
+            for (const EventoHistorial& evento : lector) {
+                if (evento.tipo == TipoEvento::CARTA) {
+                    desplazamiento = posicion + 2;  // Byte del código de la carta
+                    break;
+                }
+                posicion += EscritorHistorial::tamanoRegistro(static_cast<uint8_t>(evento.tipo));
+            }
+            lector.cerrar();
+            {
+                fstream archivo(ruta, ios::in | ios::out | ios::binary);
+                archivo.seekg(desplazamiento);
+                char codigo = static_cast<char>(archivo.get());
+                archivo.seekp(desplazamiento);
+                archivo.put(static_cast<char>(codigo ^ 0x10));  // Otro palo
+            }
+            assert(lector.abrir(ruta));
+            MotorRepeticion motor;
+            ResultadoRepeticion resultado = motor.repetir(lector);
+            assert(!resultado.correcto);
+            assert(resultado.error == "Carta distinta a la del zapato");
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+        ejecutarPrueba("Repetir rondas de consola con divisiones, dobles y seguros", []() {
+            const string ruta = "repeticion_consola.bjh";
+            remove(ruta.c_str());
+            {
+                ControladorJuego controlador(2, 0.75, ModoSalida::NULA, 3);
+                controlador.agregarJugador("Ana", Dinero::desdeDolares(100000));
+                controlador.agregarJugador("Luis", Dinero::desdeDolares(100000));
+                assert(controlador.activarHistorial(ruta));
+                // Las opciones que no se pueden tomar se vuelven a preguntar
+                const char* respuestas[] = {"v", "d", "s", "r", "n", "s", "v"};
+                size_t turno = 0;
+                for (int ronda = 0; ronda < 300; ronda++) {
+                    controlador.comenzarRonda();
+                    while (!controlador.rondaTerminada()) {
+                        bool apuesta = controlador.solicitudPendiente().tipo == TipoSolicitud::APUESTA;
+                        controlador.entregarEntrada(apuesta ? "10" : respuestas[turno++ % 7]);
+                    }
+                }
+            }
+
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            uint64_t divisiones = 0, dobles = 0, seguros = 0;
+            for (const EventoHistorial& evento : lector) {
+                divisiones += evento.tipo == TipoEvento::DECISION && evento.accion == Accion::DIVIDIR;
+                dobles += evento.tipo == TipoEvento::DECISION && evento.accion == Accion::DOBLAR;
+                seguros += evento.tipo == TipoEvento::SEGURO;
+            }
+            assert(divisiones > 0 && dobles > 0 && seguros > 0);
+
+            MotorRepeticion motor;
+            ResultadoRepeticion resultado = motor.repetir(lector);
+            assert(resultado.correcto);
+            assert(resultado.rondas == 300);
+            assert(resultado.manos == 600 + divisiones);
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase ServidorMesas
+     */
+    void pruebasServidorMesas() {
+        cout << "\n--- PRUEBAS CLASE SERVIDOR MESAS ---" << endl;
+
+        ejecutarPrueba("Jugar en dos mesas por socket UNIX", []() {
+            const string ruta = "servidor_prueba.sock";
+            ServidorMesas servidor(100, 2);
+            assert(servidor.escucharUnix(ruta));
+            thread hilo([&servidor]() { servidor.ejecutar(); });
+
+            int ana = conectarUnix(ruta);
+            int luis = conectarUnix(ruta);
+            assert(ana >= 0 && luis >= 0);
+            string mensaje = "MESA 3 Ana\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+            mensaje = "MESA 4 Luis\nPEDIR\n";
+            send(luis, mensaje.data(), mensaje.size(), 0);
+
+            string pendienteAna, pendienteLuis;
+            assert(leerLinea(ana, pendienteAna) == "OK 0");
+            assert(esperarLinea(ana, pendienteAna, "ASIENTO 0 Ana") == "ASIENTO 0 Ana");
+            assert(esperarLinea(ana, pendienteAna, "TURNO ") == "TURNO 0 APUESTA");
+            assert(leerLinea(luis, pendienteLuis) == "OK 0");
+            assert(esperarLinea(luis, pendienteLuis, "ERROR") == "ERROR No es tu turno");
+
+            mensaje = "APOSTAR\nAPOSTAR 10\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+            assert(esperarLinea(ana, pendienteAna, "ERROR") == "ERROR Falta la cantidad");
+            assert(esperarLinea(ana, pendienteAna, "TEXTO Ana apuesta $") == "TEXTO Ana apuesta $10");
+            // Decisión, seguro o, si el crupier tiene Blackjack, la apuesta de la ronda siguiente
+            assert(esperarLinea(ana, pendienteAna, "TURNO ").rfind("TURNO 0 ", 0) == 0);
+
+            close(ana);
+            close(luis);
+            servidor.detener();
+            hilo.join();
+        });
+
+        ejecutarPrueba("Jugar rondas completas por el protocolo", []() {
+            const string ruta = "servidor_prueba.sock";
+            ServidorMesas servidor(10, 1);
+            assert(servidor.escucharUnix(ruta));
+            thread hilo([&servidor]() { servidor.ejecutar(); });
+
+            int clientes[2] = {conectarUnix(ruta), conectarUnix(ruta)};
+            string pendientes[2];
+            string mensaje = "MESA 1 Ana\n";
+            send(clientes[0], mensaje.data(), mensaje.size(), 0);
+            assert(leerLinea(clientes[0], pendientes[0]) == "OK 0");
+            // Luis llega con la primera ronda abierta y se sienta al terminarla
+            mensaje = "MESA 1 Luis\n";
+            send(clientes[1], mensaje.data(), mensaje.size(), 0);
+
+            // Ana recibe todo lo que difunde la mesa y responde por quien tenga el turno
+            int rondas = 0;
+            bool apostoLuis = false;
+            while (rondas < 10) {
+                string linea = leerLinea(clientes[0], pendientes[0]);
+                assert(!linea.empty());
+                apostoLuis = apostoLuis || linea == "TEXTO Luis apuesta $10";
+                if (linea.rfind("TURNO ", 0) != 0) continue;
+                int asiento = linea[6] - '0';
+                assert(asiento == 0 || asiento == 1);
+                bool apuesta = linea.find("APUESTA") != string::npos;
+                if (apuesta && asiento == 0) rondas++;
+                mensaje = apuesta ? "APOSTAR 10\n"
+                        : linea.find("SEGURO") != string::npos ? "NO_SEGURO\n" : "PLANTARSE\n";
+                // Quien no tiene el turno es rechazado sin cambiar la ronda
+                send(clientes[1 - asiento], mensaje.data(), mensaje.size(), 0);
+                send(clientes[asiento], mensaje.data(), mensaje.size(), 0);
+            }
+            assert(apostoLuis);
+            assert(esperarLinea(clientes[1], pendientes[1], "OK ") == "OK 1");
+            assert(esperarLinea(clientes[1], pendientes[1], "ERROR") == "ERROR No es tu turno");
+
+            close(clientes[0]);
+            close(clientes[1]);
+            servidor.detener();
+            hilo.join();
+        });
+
+        ejecutarPrueba("Seguro, doblar, dividir y rendirse por el protocolo", []() {
+            const string ruta = "servidor_prueba.sock";
+            ServidorMesas servidor(10, 1);
+            assert(servidor.escucharUnix(ruta));
+            thread hilo([&servidor]() { servidor.ejecutar(); });
+
+            int ana = conectarUnix(ruta);
+            string pendiente;
+            string mensaje = "MESA 5 Ana\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+            assert(leerLinea(ana, pendiente) == "OK 0");
+
+            // Cada decisión prueba la siguiente opción; las no disponibles se vuelven a pedir
+            const string decisiones[] = {"DIVIDIR\n", "DOBLAR\n", "RENDIRSE\n", "PLANTARSE\n"};
+            size_t siguiente = 0;
+            bool seguro = false, dividio = false, doblo = false, rindio = false, rechazo = false, fueraDeTurno = false;
+            for (int lineas = 0;
+                 lineas < 200000 && !(seguro && dividio && doblo && rindio && rechazo && fueraDeTurno); lineas++) {
+                string linea = leerLinea(ana, pendiente);
+                assert(!linea.empty());
+                seguro = seguro || linea == "TEXTO Ana toma seguro.";
+                dividio = dividio || linea == "TEXTO Ana divide la pareja.";
+                doblo = doblo || linea == "TEXTO Ana dobla la apuesta.";
+                rindio = rindio || linea == "TEXTO Ana se rinde y recupera media apuesta.";
+                rechazo = rechazo || linea == "TEXTO Esa opción no está disponible.";
+                // Durante el seguro no se acepta una decisión de juego
+                fueraDeTurno = fueraDeTurno || linea == "ERROR No es tu turno";
+                if (linea == "TURNO 0 APUESTA") {
+                    mensaje = "APOSTAR 1\n";
+                } else if (linea == "TURNO 0 SEGURO") {
+                    mensaje = "PLANTARSE\nSEGURO\n";
+                } else if (linea == "TURNO 0 DECISION") {
+                    mensaje = decisiones[siguiente++ % 4];
+                } else {
+                    continue;
+                }
+                send(ana, mensaje.data(), mensaje.size(), 0);
+            }
+            assert(seguro && dividio && doblo && rindio && rechazo && fueraDeTurno);
+
+            close(ana);
+            servidor.detener();
+            hilo.join();
+        });
+
+        ejecutarPrueba("Llegar durante una decisión espera al final de la ronda", []() {
+            const string ruta = "servidor_prueba.sock";
+            ServidorMesas servidor(10, 1);
+            assert(servidor.escucharUnix(ruta));
+            thread hilo([&servidor]() { servidor.ejecutar(); });
+
+            int ana = conectarUnix(ruta);
+            string pendienteAna;
+            string mensaje = "MESA 6 Ana\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+            assert(leerLinea(ana, pendienteAna) == "OK 0");
+
+            // Ana apuesta hasta que la mesa le pide una decisión
+            string linea;
+            do {
+                linea = esperarLinea(ana, pendienteAna, "TURNO ");
+                assert(!linea.empty());
+                mensaje = linea == "TURNO 0 APUESTA" ? "APOSTAR 10\n"
+                        : linea == "TURNO 0 SEGURO" ? "NO_SEGURO\n" : "";
+                send(ana, mensaje.data(), mensaje.size(), 0);
+            } while (linea != "TURNO 0 DECISION");
+
+            int luis = conectarUnix(ruta);
+            string pendienteLuis;
+            mensaje = "MESA 6 Luis\nPEDIR\n";
+            send(luis, mensaje.data(), mensaje.size(), 0);
+            assert(esperarLinea(luis, pendienteLuis, "ERROR") == "ERROR No es tu turno");
+
+            // La ronda en curso termina con Ana sola y después entra Luis
+            mensaje = "PLANTARSE\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+            assert(esperarLinea(ana, pendienteAna, "TEXTO Ana se planta con ").rfind("TEXTO Ana se planta con ", 0) == 0);
+            assert(esperarLinea(ana, pendienteAna, "ASIENTO ") == "ASIENTO 1 Luis");
+            assert(esperarLinea(ana, pendienteAna, "TURNO ") == "TURNO 0 APUESTA");
+            assert(leerLinea(luis, pendienteLuis) == "OK 1");
+
+            close(ana);
+            close(luis);
+            servidor.detener();
+            hilo.join();
+        });
+
+        ejecutarPrueba("Irse a mitad de ronda no detiene la mesa", []() {
+            const string ruta = "servidor_prueba.sock";
+            ServidorMesas servidor(10, 1);
+            assert(servidor.escucharUnix(ruta));
+            thread hilo([&servidor]() { servidor.ejecutar(); });
+
+            int ana = conectarUnix(ruta);
+            int luis = conectarUnix(ruta);
+            string pendienteAna, pendienteLuis;
+            string mensaje = "MESA 2 Ana\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+            assert(esperarLinea(ana, pendienteAna, "TURNO ") == "TURNO 0 APUESTA");
+            mensaje = "MESA 2 Luis\n";
+            send(luis, mensaje.data(), mensaje.size(), 0);
+            mensaje = "APOSTAR 10\n";
+            send(ana, mensaje.data(), mensaje.size(), 0);
+
+            // Luis se va en cuanto la mesa le pide algo
+            string linea;
+            do {
+                linea = leerLinea(ana, pendienteAna);
+                assert(!linea.empty());
+                if (linea == "TURNO 0 APUESTA") {
+                    mensaje = "APOSTAR 10\n";
+                    send(ana, mensaje.data(), mensaje.size(), 0);
+                } else if (linea == "TURNO 0 SEGURO") {
+                    mensaje = "NO_SEGURO\n";
+                    send(ana, mensaje.data(), mensaje.size(), 0);
+                } else if (linea == "TURNO 0 DECISION") {
+                    mensaje = "PLANTARSE\n";
+                    send(ana, mensaje.data(), mensaje.size(), 0);
+                }
+            } while (linea.rfind("TURNO 1 ", 0) != 0);
+            assert(leerLinea(luis, pendienteLuis) == "OK 1");
+            mensaje = "SALIR\n";
+            send(luis, mensaje.data(), mensaje.size(), 0);
+            assert(esperarLinea(ana, pendienteAna, "SALE ") == "SALE 1");
+
+            // La ronda sigue sin Luis y su asiento queda libre para quien llegue
+            int eva = conectarUnix(ruta);
+            string pendienteEva;
+            mensaje = "MESA 2 Eva\n";
+            send(eva, mensaje.data(), mensaje.size(), 0);
+            do {
+                linea = leerLinea(ana, pendienteAna);
+                assert(!linea.empty() && linea.rfind("TURNO 1 ", 0) != 0);
+                mensaje = linea == "TURNO 0 APUESTA" ? "APOSTAR 10\n"
+                        : linea == "TURNO 0 SEGURO" ? "NO_SEGURO\n"
+                        : linea == "TURNO 0 DECISION" ? "PLANTARSE\n" : "";
+                send(ana, mensaje.data(), mensaje.size(), 0);
+            } while (linea != "ASIENTO 1 Eva");
+            assert(leerLinea(eva, pendienteEva) == "OK 1");
+
+            close(ana);
+            close(luis);
+            close(eva);
+            servidor.detener();
+            hilo.join();
+        });
+
+        ejecutarPrueba("Rechazar una primera línea inválida", []() {
+            const string ruta = "servidor_prueba.sock";
+            ServidorMesas servidor(10, 1);
+            assert(servidor.escucharUnix(ruta));
+            thread hilo([&servidor]() { servidor.ejecutar(); });
+
+            int cliente = conectarUnix(ruta);
+            string mensaje = "MESA 99 Ana\nHOLA\n";
+            send(cliente, mensaje.data(), mensaje.size(), 0);
+            string recibido = leerHasta(cliente, "MESA <n> <nombre>\nERROR");
+            assert(recibido == "ERROR Se esperaba MESA <n> <nombre>\nERROR Se esperaba MESA <n> <nombre>\n");
+
+            close(cliente);
+            servidor.detener();
+            hilo.join();
+        });
     }
 
     /**
@@ -212,9 +1562,621 @@ private:
 
         ejecutarPrueba("Agregar jugador", []() {
             ControladorJuego controlador;
-            controlador.agregarJugador("TestPlayer", 100.0);
+            controlador.agregarJugador("TestPlayer", 10000);
             // No hay getter directo para verificar, pero no debe fallar
         });
+
+        ejecutarPrueba("Ronda suspendida esperando la entrada", []() {
+            ControladorJuego controlador(1, 0.75, ModoSalida::NULA);
+            controlador.agregarJugador("Ana", 10000);
+            controlador.agregarJugador("Luis", 10000);
+            controlador.comenzarRonda();
+            assert(!controlador.rondaTerminada());
+            assert(controlador.obtenerEstadoActual() == EstadoJuego::APOSTANDO);
+            assert(controlador.solicitudPendiente().tipo == TipoSolicitud::APUESTA);
+            assert(controlador.solicitudPendiente().asiento == 0);
+
+            assert(controlador.entregarEntrada("10"));
+            assert(controlador.solicitudPendiente().asiento == 1);
+            // La ronda suspendida recorre los asientos: nadie se sienta hasta que termine
+            assert(controlador.agregarJugador("Eva", 10000) == -1);
+            assert(controlador.agregarApuestaDetras(0, "Eva", 10000) == -1);
+            assert(controlador.obtenerAsientos().numPosiciones() == 2);
+            assert(controlador.entregarEntrada("diez"));  // No es un número: se vuelve a pedir
+            assert(controlador.solicitudPendiente().tipo == TipoSolicitud::APUESTA);
+            assert(controlador.solicitudPendiente().asiento == 1);
+            assert(controlador.entregarEntrada("0"));
+
+            while (!controlador.rondaTerminada()) {
+                // Con un As del crupier primero se ofrece el seguro a la posición 0
+                assert(controlador.solicitudPendiente().tipo == TipoSolicitud::DECISION ||
+                       controlador.solicitudPendiente().tipo == TipoSolicitud::SEGURO);
+                assert(controlador.solicitudPendiente().asiento == 0);
+                controlador.entregarEntrada("n");
+            }
+            assert(controlador.obtenerEstadoActual() == EstadoJuego::FINALIZADO);
+            assert(controlador.solicitudPendiente().tipo == TipoSolicitud::NINGUNA);
+            assert(!controlador.entregarEntrada("s"));
+        });
+
+        ejecutarPrueba("Miles de rondas en curso en un hilo", []() {
+            const int MESAS = 5000;
+            vector<unique_ptr<ControladorJuego>> mesas;
+            for (int i = 0; i < MESAS; i++) {
+                mesas.push_back(make_unique<ControladorJuego>(1, 0.75, ModoSalida::NULA));
+                mesas.back()->agregarJugador("Jugador", 10000);
+                mesas.back()->comenzarRonda();
+            }
+            // Todas las rondas quedan suspendidas a la vez, cada una en su propia fase
+            int enCurso = MESAS;
+            while (enCurso > 0) {
+                enCurso = 0;
+                for (auto& mesa : mesas) {
+                    if (mesa->rondaTerminada()) continue;
+                    bool apuesta = mesa->solicitudPendiente().tipo == TipoSolicitud::APUESTA;
+                    mesa->entregarEntrada(apuesta ? "10" : "n");
+                    enCurso += !mesa->rondaTerminada();
+                }
+            }
+            for (auto& mesa : mesas) {
+                assert(mesa->obtenerEstadoActual() == EstadoJuego::FINALIZADO);
+            }
+        });
+
+        ejecutarPrueba("Un pago que desbordaría no se registra como cobrado", []() {
+            const string ruta = "historial_desborde.bjh";
+            remove(ruta.c_str());
+            int rondas = 0, rechazadas = 0;
+            {
+                ControladorJuego controlador(1, 0.75, ModoSalida::NULA);
+                controlador.agregarJugador("Ana", INT64_MAX);
+                controlador.agregarApuestaDetras(0, "Eva", Dinero::desdeDolares(100000));
+                assert(controlador.activarHistorial(ruta));
+                const Asientos& asientos = controlador.obtenerAsientos();
+                // Con esta apuesta cualquier ganancia de Ana desborda; Eva sigue la
+                // misma mano: si ella cobra y Ana no, el pago de Ana se rechazó
+                while (rechazadas == 0 && rondas < 2000) {
+                    Centavos ana = asientos.obtenerDinero(0), eva = asientos.obtenerDinero(1);
+                    Centavos apuestaAna = INT64_MAX - ana + 1000;
+                    controlador.comenzarRonda();
+                    while (!controlador.rondaTerminada()) {
+                        const SolicitudEntrada& solicitud = controlador.solicitudPendiente();
+                        if (solicitud.tipo == TipoSolicitud::APUESTA) {
+                            controlador.entregarEntrada(solicitud.asiento == 0 ? Dinero::formatear(apuestaAna) : "10");
+                        } else {
+                            controlador.entregarEntrada("n");
+                        }
+                    }
+                    rondas++;
+                    rechazadas += asientos.obtenerDinero(1) > eva && asientos.obtenerDinero(0) == ana - apuestaAna;
+                }
+            }
+            assert(rechazadas == 1);
+
+            // Eva se liquida todas las rondas; Ana, todas menos la rechazada
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            int liquidaciones = 0;
+            for (const EventoHistorial& evento : lector) {
+                liquidaciones += evento.tipo == TipoEvento::LIQUIDACION;
+            }
+            assert(liquidaciones == 2 * rondas - rechazadas);
+            assert(MotorRepeticion().repetir(lector).correcto);
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Quien apuesta detrás queda en el historial", []() {
+            const string ruta = "historial_detras.bjh";
+            remove(ruta.c_str());
+            const int rondas = 300;
+            {
+                ControladorJuego controlador(1, 0.75, ModoSalida::NULA);
+                controlador.agregarJugador("Ana", Dinero::desdeDolares(100000));
+                controlador.agregarApuestaDetras(0, "Eva", Dinero::desdeDolares(100000));
+                controlador.agregarApuestaDetras(0, "Luis", Dinero::desdeDolares(100000));
+                assert(controlador.activarHistorial(ruta));
+                for (int ronda = 0; ronda < rondas; ronda++) {
+                    controlador.comenzarRonda();
+                    while (!controlador.rondaTerminada()) {
+                        // Ana apuesta 10, Eva 4 y se asegura, Luis no apuesta
+                        const SolicitudEntrada& solicitud = controlador.solicitudPendiente();
+                        if (solicitud.tipo == TipoSolicitud::APUESTA) {
+                            controlador.entregarEntrada(solicitud.asiento == 0 ? "10" : solicitud.asiento == 1 ? "4" : "0");
+                        } else {
+                            controlador.entregarEntrada(solicitud.tipo == TipoSolicitud::SEGURO && solicitud.asiento == 1 ? "s" : "n");
+                        }
+                    }
+                }
+            }
+
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            int apuestasEva = 0, segurosEva = 0, liquidacionesEva = 0, deLuis = 0;
+            EventoHistorial ultimo;
+            for (const EventoHistorial& evento : lector) {
+                bool eva = evento.apostador == 1 && evento.asiento == 0;
+                apuestasEva += eva && evento.tipo == TipoEvento::APUESTA && evento.centavos == 400;
+                segurosEva += eva && evento.tipo == TipoEvento::SEGURO && evento.centavos == 200;
+                liquidacionesEva += eva && evento.tipo == TipoEvento::LIQUIDACION;
+                deLuis += evento.apostador == 2;
+                ultimo = evento;
+            }
+            assert(apuestasEva == rondas && liquidacionesEva == rondas);
+            assert(segurosEva > 0 && deLuis == 0);
+            assert(MotorRepeticion().repetir(lector).correcto);
+            lector.cerrar();
+
+            // El pago de Eva se verifica contra la primera mano de Ana
+            assert(ultimo.tipo == TipoEvento::LIQUIDACION && ultimo.apostador == 1);
+            {
+                fstream archivo(ruta, ios::in | ios::out | ios::binary);
+                archivo.seekp(-1, ios::end);
+                archivo.put(char(0x01));
+            }
+            assert(lector.abrir(ruta));
+            ResultadoRepeticion resultado = MotorRepeticion().repetir(lector);
+            assert(!resultado.correcto && resultado.error == "Pago distinto");
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("La variante de la mesa decide el crupier y el pago", []() {
+            const string ruta = "historial_variante.bjh";
+            remove(ruta.c_str());
+            ControladorJuego controlador(1, 0.75, ModoSalida::NULA);
+            controlador.agregarJugador("Ana", Dinero::desdeDolares(100000));
+            ConfiguracionReglas reglas;
+            reglas.crupierPideSuave17 = true;
+            reglas.pagoBlackjack = PagoBlackjack::SEIS_A_CINCO;
+            assert(!controlador.establecerReglas(reglas));  // 6 barajas en un zapato de 1
+            reglas.numBarajas = 1;
+            assert(controlador.activarHistorial(ruta));
+            assert(controlador.establecerReglas(reglas));
+
+            const Asientos& asientos = controlador.obtenerAsientos();
+            int blackjacks = 0;
+            for (int ronda = 0; ronda < 400; ronda++) {
+                Centavos antes = asientos.obtenerDinero(0);
+                controlador.comenzarRonda();
+                assert(!controlador.establecerReglas(reglas));  // No cambia a mitad de ronda
+                while (!controlador.rondaTerminada()) {
+                    bool apuesta = controlador.solicitudPendiente().tipo == TipoSolicitud::APUESTA;
+                    controlador.entregarEntrada(apuesta ? "10" : "n");
+                }
+                // Un Blackjack de $10 cobra $12 con 6:5
+                assert(asientos.obtenerDinero(0) - antes != 1500);
+                blackjacks += asientos.obtenerDinero(0) - antes == 1200;
+            }
+            assert(blackjacks > 0);
+
+            // La repetición sigue la variante registrada: H17 y 6:5
+            LectorHistorial lector;
+            assert(lector.abrir(ruta));
+            int eventosReglas = 0;
+            for (const EventoHistorial& evento : lector) {
+                if (evento.tipo == TipoEvento::REGLAS) {
+                    eventosReglas++;
+                }
+            }
+            assert(eventosReglas == 2);
+            assert(MotorRepeticion().repetir(lector).correcto);
+            lector.cerrar();
+            remove(ruta.c_str());
+        });
+
+        ejecutarPrueba("Mesa grande con apuestas detrás", []() {
+            ControladorJuego controlador(6, 0.75, ModoSalida::NULA, 20);
+            for (int i = 0; i < 20; i++) {
+                assert(controlador.agregarJugador("Titular" + to_string(i), 10000) == i);
+            }
+            assert(controlador.agregarJugador("Sobra", 10000) == -1);
+            for (int asiento = 0; asiento < 20; asiento++) {
+                for (int i = 0; i < 10; i++) {
+                    assert(controlador.agregarApuestaDetras(asiento, "Detras", 10000) >= 20);
+                }
+            }
+
+            controlador.comenzarRonda();
+            while (!controlador.rondaTerminada()) {
+                bool apuesta = controlador.solicitudPendiente().tipo == TipoSolicitud::APUESTA;
+                controlador.entregarEntrada(apuesta ? "10" : "n");
+            }
+            // Misma apuesta sobre la misma mano: mismo resultado que el titular
+            const Asientos& asientos = controlador.obtenerAsientos();
+            assert(asientos.numPosiciones() == 220);
+            for (int posicion = 20; posicion < asientos.numPosiciones(); posicion++) {
+                int titular = asientos.obtenerTitular(asientos.obtenerAsiento(posicion));
+                assert(asientos.obtenerDinero(posicion) == asientos.obtenerDinero(titular));
+                assert(asientos.obtenerApuesta(posicion) == 1000);
+            }
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Reglas
+     */
+    void pruebasReglas() {
+        cout << "\n--- PRUEBAS CLASE REGLAS ---" << endl;
+
+        ejecutarPrueba("Blackjack del crupier gana a 21", []() {
+            Mano jugador, crupier;
+            jugador.agregarCarta(Carta("7", "Picas"));
+            jugador.agregarCarta(Carta("7", "Corazones"));
+            jugador.agregarCarta(Carta("7", "Diamantes"));
+            crupier.agregarCarta(Carta("A", "Picas"));
+            crupier.agregarCarta(Carta("Q", "Picas"));
+            assert(Reglas::compararManos(jugador, crupier) == -1);
+        });
+
+        ejecutarPrueba("Retorno de apuestas", []() {
+            assert(Reglas::calcularRetorno(1, true, 1000) == 2500);
+            assert(Reglas::calcularRetorno(1, false, 1000) == 2000);
+            assert(Reglas::calcularRetorno(0, false, 1000) == 1000);
+            assert(Reglas::calcularRetorno(-1, false, 1000) == 0);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase ConjuntoReglas
+     */
+    void pruebasConjuntoReglas() {
+        cout << "\n--- PRUEBAS CLASE CONJUNTO REGLAS ---" << endl;
+
+        ejecutarPrueba("El crupier pide con 17 suave solo en H17", []() {
+            using H17 = ConjuntoReglas<true, true, false, PagoBlackjack::TRES_A_DOS>;
+            Mano suave17, duro17;
+            suave17.agregarCarta(Carta("A", "Picas"));
+            suave17.agregarCarta(Carta("6", "Picas"));
+            duro17.agregarCarta(Carta("10", "Picas"));
+            duro17.agregarCarta(Carta("7", "Picas"));
+            assert(!ReglasEstandar::crupierDebePedir(suave17) && H17::crupierDebePedir(suave17));
+            assert(!ReglasEstandar::crupierDebePedir(duro17) && !H17::crupierDebePedir(duro17));
+            static_assert(ReglasEstandar::PIDE_CRUPIER == Reglas::PIDE_CRUPIER, "S17 coincide con Reglas");
+
+            Crupier crupier;
+            crupier.recibirCarta(Carta("A", "Picas"));
+            crupier.recibirCarta(Carta("6", "Picas"));
+            assert(!crupier.quiereOtraCarta());
+            ConfiguracionReglas reglas;
+            reglas.crupierPideSuave17 = true;
+            crupier.establecerReglas(reglas);
+            assert(crupier.quiereOtraCarta());
+            assert(&reglas.tablaCrupier() == &H17::PIDE_CRUPIER);
+        });
+
+        ejecutarPrueba("Pagos 3:2, 6:5 y rendición redondean hacia abajo", []() {
+            using SeisACinco = ConjuntoReglas<false, true, true, PagoBlackjack::SEIS_A_CINCO>;
+            static_assert(ReglasEstandar::calcularRetorno(1, true, 1001) == 1001 + 1501, "3:2");
+            static_assert(SeisACinco::calcularRetorno(1, true, 1001) == 1001 + 1201, "6:5");
+            static_assert(SeisACinco::calcularRetorno(0, true, 1001) == 1001, "empate");
+            static_assert(SeisACinco::calcularRetornoRendicion(1001) == 500, "rendición");
+            ConfiguracionReglas reglas;
+            reglas.pagoBlackjack = PagoBlackjack::SEIS_A_CINCO;
+            assert(Liquidacion::retornoDe(Liquidacion::GANA_BLACKJACK, 1001, reglas.numeradorBlackjack(),
+                                          reglas.denominadorBlackjack()) == 1001 + 1201);
+            assert(Liquidacion::retornoDe(Liquidacion::GANA_BLACKJACK, 1001) == 1001 + 1501);
+            for (int resultado = -1; resultado <= 1; resultado++) {
+                assert(ReglasEstandar::calcularRetorno(resultado, false, 1250) == Reglas::calcularRetorno(resultado, false, 1250));
+                assert(ReglasEstandar::calcularRetorno(resultado, true, 1250) == Reglas::calcularRetorno(resultado, true, 1250));
+            }
+        });
+
+        ejecutarPrueba("Despacho elige la variante configurada", []() {
+            ConfiguracionReglas reglas;
+            reglas.crupierPideSuave17 = true;
+            reglas.doblarTrasDividir = false;
+            reglas.rendicionTardia = true;
+            reglas.pagoBlackjack = PagoBlackjack::SEIS_A_CINCO;
+            reglas.maxManos = 9;
+            bool correcta = false;
+            reglas.despachar([&](auto conjunto) {
+                using R = decltype(conjunto);
+                correcta = R::CRUPIER_PIDE_SUAVE_17 && !R::DOBLA_TRAS_DIVIDIR && R::RENDICION &&
+                           R::PAGO_BLACKJACK == PagoBlackjack::SEIS_A_CINCO && !R::puedeDoblar(true);
+            });
+            assert(correcta);
+            assert(reglas.manosPermitidas() == ConfiguracionReglas::MAX_MANOS);
+            assert(reglas.describir() == "6 barajas, H17, sin DAS, 4 manos, RS, 6:5");
+            reglas.crupierRevisaBlackjack = false;
+            assert(reglas.describir() == "6 barajas, H17, sin DAS, 4 manos, RS, 6:5, sin revisión");
+        });
+
+        ejecutarPrueba("Un 21 de mano dividida no es Blackjack", []() {
+            Mano jugador, crupier;
+            jugador.agregarCarta(Carta("A", "Picas"));
+            jugador.agregarCarta(Carta("K", "Picas"));
+            crupier.agregarCarta(Carta("7", "Picas"));
+            crupier.agregarCarta(Carta("7", "Corazones"));
+            crupier.agregarCarta(Carta("7", "Diamantes"));
+            assert(Reglas::compararManos(jugador, crupier) == 1);
+            assert(Reglas::compararManos(jugador, crupier, true) == 0);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Dinero
+     */
+    void pruebasDinero() {
+        cout << "\n--- PRUEBAS CLASE DINERO ---" << endl;
+
+        ejecutarPrueba("Suma y resta con desbordamiento", []() {
+            Centavos resultado = 7;
+            assert(Dinero::sumar(1050, 250, resultado) && resultado == 1300);
+            assert(Dinero::restar(1000, 1250, resultado) && resultado == -250);
+            assert(!Dinero::sumar(INT64_MAX, 1, resultado) && resultado == -250);
+            assert(!Dinero::restar(INT64_MIN, 1, resultado));
+        });
+
+        ejecutarPrueba("Pagos proporcionales redondean hacia abajo", []() {
+            Centavos pago = 0;
+            assert(Dinero::aplicarProporcion(5, 3, 2, pago) && pago == 7);
+            assert(Dinero::aplicarProporcion(1001, 6, 5, pago) && pago == 1201);
+            assert(Reglas::calcularPagoBlackjack(1250) == 1875);
+            assert(Reglas::calcularRetorno(1, true, 5) == 12);
+            assert(!Dinero::aplicarProporcion(INT64_MAX / 2, 3, 2, pago));
+        });
+
+        ejecutarPrueba("Texto y formato en dólares", []() {
+            Centavos cantidad = 0;
+            assert(Dinero::desdeTexto(" 12.5 ", cantidad) && cantidad == 1250);
+            assert(Dinero::desdeTexto("7,25", cantidad) && cantidad == 725);
+            assert(Dinero::desdeTexto("-3", cantidad) && cantidad == -300);
+            assert(!Dinero::desdeTexto("0.125", cantidad));
+            assert(!Dinero::desdeTexto("abc", cantidad) && !Dinero::desdeTexto(".", cantidad));
+            assert(Dinero::formatear(101000) == "1010");
+            assert(Dinero::formatear(1250) == "12.50");
+            assert(Dinero::formatear(-305) == "-3.05");
+        });
+
+        ejecutarPrueba("Saldos que desbordarían no cambian", []() {
+            Asientos asientos(2);
+            asientos.sentar("Ana", INT64_MAX - 10);
+            asientos.sentar("Luis", 100);
+            assert(!asientos.pagarTodos({20, 20}));
+            assert(asientos.obtenerDinero(0) == INT64_MAX - 10);
+            assert(asientos.obtenerDinero(1) == 120);
+            Jugador jugador("J", INT64_MAX);
+            assert(!jugador.ganar(1) && jugador.obtenerDinero() == INT64_MAX);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase EstrategiaBasica
+     */
+    void pruebasEstrategiaBasica() {
+        cout << "\n--- PRUEBAS CLASE ESTRATEGIA BASICA ---" << endl;
+
+        ejecutarPrueba("Decisiones de la tabla por defecto", []() {
+            EstrategiaBasica estrategia;
+            Mano once, doceSuave, ochos, dieciseis;
+            once.agregarCarta(Carta("5", "Picas"));
+            once.agregarCarta(Carta("6", "Picas"));
+            ochos.agregarCarta(Carta("8", "Picas"));
+            ochos.agregarCarta(Carta("8", "Corazones"));
+            dieciseis.agregarCarta(Carta("10", "Picas"));
+            dieciseis.agregarCarta(Carta("6", "Corazones"));
+            assert(estrategia.decidir(once, Carta("6", "Diamantes")) == Accion::DOBLAR);
+            assert(estrategia.decidir(ochos, Carta("10", "Diamantes")) == Accion::DIVIDIR);
+            assert(estrategia.decidir(ochos, Carta("10", "Diamantes"), false) == Accion::PEDIR);
+            assert(estrategia.decidir(dieciseis, Carta("6", "Diamantes")) == Accion::PLANTARSE);
+            assert(estrategia.decidir(dieciseis, Carta("A", "Diamantes")) == Accion::PEDIR);
+            assert(estrategia.decidir(dieciseis, Carta("A", "Diamantes"), true, true) == Accion::RENDIRSE);
+        });
+
+        ejecutarPrueba("Cargar estrategia desde archivo", []() {
+            const string ruta = "estrategia_prueba.txt";
+            {
+                ofstream archivo(ruta);
+                archivo << "# 16 duro: plantarse siempre\n";
+                archivo << "DURA 16 S S S S S S S S S S\n";
+            }
+            EstrategiaBasica estrategia;
+            assert(estrategia.cargarDesdeArchivo(ruta));
+            remove(ruta.c_str());
+            Mano dieciseis;
+            dieciseis.agregarCarta(Carta("10", "Picas"));
+            dieciseis.agregarCarta(Carta("6", "Corazones"));
+            assert(estrategia.decidir(dieciseis, Carta("A", "Diamantes")) == Accion::PLANTARSE);
+            assert(!estrategia.cargarDesdeArchivo("no_existe.txt"));
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase ProbabilidadCrupier
+     */
+    void pruebasProbabilidadCrupier() {
+        cout << "\n--- PRUEBAS CLASE PROBABILIDAD CRUPIER ---" << endl;
+
+        ejecutarPrueba("Zapato solo con dieces", []() {
+            ProbabilidadCrupier motor;
+            Composicion dieces{};
+            dieces[9] = 20;
+            assert(motor.calcular(9, dieces).probabilidadTotal(20) == 1.0);
+            assert(motor.calcular(5, dieces).probabilidadPasarse() == 1.0);
+            assert(motor.calcular(0, dieces).probabilidadBlackjack() == 1.0);
+        });
+
+        ejecutarPrueba("Distribución completa suma 1", []() {
+            ProbabilidadCrupier motor;
+            Mazo zapato(6);
+            Composicion restantes = zapato.obtenerComposicion();
+            restantes[5]--;  // La carta visible es un 6
+            DistribucionCrupier d = motor.calcular(5, restantes);
+            double suma = 0.0;
+            for (double p : d.probabilidades) suma += p;
+            assert(fabs(suma - 1.0) < 1e-9);
+            assert(d.probabilidadPasarse() > 0.40 && d.probabilidadPasarse() < 0.43);
+            size_t estados = motor.tamanoCache();
+            motor.calcular(5, restantes);
+            assert(motor.tamanoCache() == estados);
+        });
+
+        ejecutarPrueba("H17 y la revisión cambian la distribución", []() {
+            ConfiguracionReglas h17, sinRevision;
+            h17.crupierPideSuave17 = true;
+            sinRevision.crupierRevisaBlackjack = false;
+            ProbabilidadCrupier s17(sinRevision), pideSuave(h17), conRevision;
+            Mazo zapato(6);
+            Composicion restantes = zapato.obtenerComposicion();
+            restantes[0]--;  // La carta visible es un As
+
+            DistribucionCrupier libre = s17.calcular(0, restantes);
+            DistribucionCrupier revisada = conRevision.calcular(0, restantes);
+            assert(libre.probabilidadBlackjack() > 0.30);
+            assert(revisada.probabilidadBlackjack() == 0.0);
+            double suma = 0.0;
+            for (double p : revisada.probabilidades) suma += p;
+            assert(fabs(suma - 1.0) < 1e-9);
+            assert(fabs(revisada.probabilidadTotal(17) * (1.0 - libre.probabilidadBlackjack()) -
+                        libre.probabilidadTotal(17)) < 1e-12);
+            // Con H17 el 17 suave (A-6) pide: menos 17 y más veces se pasa
+            DistribucionCrupier h = pideSuave.calcular(0, restantes);
+            assert(h.probabilidadTotal(17) < revisada.probabilidadTotal(17));
+            assert(h.probabilidadPasarse() > revisada.probabilidadPasarse());
+        });
+
+        ejecutarPrueba("Composición del zapato al repartir", []() {
+            Mazo zapato(1);
+            Carta carta = zapato.repartirCarta();
+            const Composicion& restantes = zapato.obtenerComposicion();
+            int total = 0;
+            for (uint16_t cantidad : restantes) total += cantidad;
+            assert(total == 51);
+            assert(restantes[carta.obtenerIndiceValor()] == (carta.obtenerIndiceValor() == 9 ? 15 : 3));
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase SolverEV
+     */
+    void pruebasSolverEV() {
+        cout << "\n--- PRUEBAS CLASE SOLVER EV ---" << endl;
+
+        ejecutarPrueba("EV de acciones en manos conocidas", []() {
+            SolverEV solver;
+            Mazo zapato(6);
+            Composicion restantes = zapato.obtenerComposicion();
+            Mano once;
+            once.agregarCarta(Carta("5", "Picas"));
+            once.agregarCarta(Carta("6", "Picas"));
+            restantes[4]--; restantes[5]--; restantes[5]--;  // 5, 6 y el 6 del crupier
+            ValoresAccion valores = solver.evaluar(once, Carta("6", "Corazones"), restantes);
+            assert(valores.puedeDoblar && !valores.puedeDividir);
+            assert(valores.mejorAccion() == Accion::DOBLAR);
+            assert(valores.doblar > valores.pedir && valores.pedir > valores.plantarse);
+        });
+
+        ejecutarPrueba("Tabla generada coincide con la básica", []() {
+            SolverEV solver;
+            Mazo zapato(6);
+            EstrategiaBasica generada = solver.generarTabla(zapato.obtenerComposicion());
+            EstrategiaBasica basica;
+            int diferencias = 0;
+            for (int fila = 0; fila < EstrategiaBasica::NUM_FILAS; fila++) {
+                for (int visible = 0; visible < Carta::NUM_VALORES; visible++) {
+                    diferencias += generada.obtenerAccion(fila, visible) != basica.obtenerAccion(fila, visible);
+                }
+            }
+            // Solo difieren celdas cercanas, resueltas con una mano representativa
+            assert(diferencias < 10);
+        });
+
+        ejecutarPrueba("La variante cambia los valores esperados", []() {
+            ConfiguracionReglas sinRevision, seisACinco, sinDAS, sinDividir;
+            sinRevision.crupierRevisaBlackjack = false;
+            seisACinco.pagoBlackjack = PagoBlackjack::SEIS_A_CINCO;
+            sinDAS.doblarTrasDividir = false;
+            sinDividir.maxManos = 1;
+            Mazo zapato(6);
+            Composicion restantes = zapato.obtenerComposicion();
+            Mano once, blackjack, nueves;
+            once.agregarCarta(Carta("5", "Picas"));
+            once.agregarCarta(Carta("6", "Picas"));
+            blackjack.agregarCarta(Carta("A", "Picas"));
+            blackjack.agregarCarta(Carta("K", "Picas"));
+            nueves.agregarCarta(Carta("9", "Picas"));
+            nueves.agregarCarta(Carta("9", "Corazones"));
+            Carta diez("10", "Corazones");
+            restantes[9] -= 2; restantes[4]--; restantes[5]--; restantes[0]--; restantes[8] -= 2;
+
+            // Sin revisión el Blackjack del crupier también se lleva el doble
+            double conRevision = SolverEV().evaluar(once, diez, restantes).doblar;
+            assert(SolverEV(sinRevision).evaluar(once, diez, restantes).doblar < conRevision - 0.1);
+            // Con revisión el Blackjack del jugador cobra el pago completo
+            assert(fabs(SolverEV().evaluar(blackjack, diez, restantes).plantarse - 1.5) < 1e-12);
+            assert(fabs(SolverEV(seisACinco).evaluar(blackjack, diez, restantes).plantarse - 1.2) < 1e-12);
+            assert(SolverEV(sinDAS).evaluar(nueves, diez, restantes).dividir <
+                   SolverEV().evaluar(nueves, diez, restantes).dividir);
+            assert(!SolverEV(sinDividir).evaluar(nueves, diez, restantes).puedeDividir);
+        });
+
+        ejecutarPrueba("Modo exacto y aproximado coinciden al plantarse", []() {
+            SolverEV exacto(ConfiguracionReglas(), true), aproximado;
+            Mazo zapato(1);
+            Composicion restantes = zapato.obtenerComposicion();
+            Mano veinte;
+            veinte.agregarCarta(Carta("K", "Picas"));
+            veinte.agregarCarta(Carta("Q", "Picas"));
+            restantes[9] -= 3;
+            double a = exacto.evaluar(veinte, Carta("10", "Corazones"), restantes).plantarse;
+            double b = aproximado.evaluar(veinte, Carta("10", "Corazones"), restantes).plantarse;
+            assert(fabs(a - b) < 1e-12);
+        });
+    }
+
+    /**
+     * @brief Pruebas para la clase Simulador
+     */
+    void pruebasSimulador() {
+        cout << "\n--- PRUEBAS CLASE SIMULADOR ---" << endl;
+
+        ejecutarPrueba("Simulación cuenta todas las manos", []() {
+            ConfiguracionSimulacion config;
+            config.estrategias.assign(3, EstrategiaBasica::imitarCrupier());
+            Simulador simulador(config);
+            ResultadoSimulacion resultado = simulador.ejecutar(1000);
+            assert(resultado.rondas == 1000);
+            assert(resultado.manos == 3000);
+            assert(resultado.victorias + resultado.empates + resultado.derrotas == 3000);
+        });
+
+        ejecutarPrueba("Simulación reproducible con semilla", []() {
+            ConfiguracionSimulacion config;
+            config.semilla = 99;
+            config.estrategias = {EstrategiaBasica::plantarseSiempre(), EstrategiaBasica::imitarCrupier()};
+            ResultadoSimulacion a = Simulador(config).ejecutar(500);
+            ResultadoSimulacion b = Simulador(config).ejecutar(500);
+            assert(a.victorias == b.victorias && a.derrotas == b.derrotas);
+            assert(a.gananciaNeta == b.gananciaNeta);
+        });
+
+        ejecutarPrueba("Simulación divide y se rinde según las reglas", []() {
+            ConfiguracionSimulacion config;
+            config.semilla = 3;
+            config.reglas.rendicionTardia = true;
+            config.estrategias.assign(3, EstrategiaBasica());
+            ResultadoSimulacion conTodo = Simulador(config).ejecutar(2000);
+            assert(conTodo.divisiones > 0 && conTodo.rendiciones > 0);
+            assert(conTodo.manos == 6000 + conTodo.divisiones);
+            assert(conTodo.victorias + conTodo.empates + conTodo.derrotas == conTodo.manos);
+
+            config.reglas.rendicionTardia = false;
+            config.reglas.maxManos = 1;
+            ResultadoSimulacion sinNada = Simulador(config).ejecutar(2000);
+            assert(sinNada.divisiones == 0 && sinNada.rendiciones == 0 && sinNada.manos == 6000);
+        });
+
+        ejecutarPrueba("Simulación paralela determinista", []() {
+            ConfiguracionSimulacion config;
+            config.semilla = 7;
+            config.estrategias.assign(2, EstrategiaBasica::imitarCrupier());
+            ResultadoSimulacion uno = SimuladorParalelo(config, 1, 1000).ejecutar(20500);
+            ResultadoSimulacion cuatro = SimuladorParalelo(config, 4, 1000).ejecutar(20500);
+            assert(uno.rondas == 20500 && cuatro.rondas == 20500);
+            assert(uno.victorias == cuatro.victorias);
+            assert(uno.gananciaNeta == cuatro.gananciaNeta);
+        });
     }
 
 public:
@@ -227,11 +2189,29 @@ public:
         cout << "========================================" << endl;
 
         pruebasCarta();
+        pruebasGeneradorAleatorio();
         pruebasMazo();
+        pruebasConteo();
         pruebasMano();
+        pruebasEstadoMano();
         pruebasJugador();
+        pruebasAsientos();
+        pruebasLiquidacion();
+        pruebasEvaluadorManos();
         pruebasCrupier();
+        pruebasPresentador();
+        pruebasSalidaJuego();
+        pruebasHistorialBinario();
+        pruebasMotorRepeticion();
+        pruebasServidorMesas();
         pruebasControladorJuego();
+        pruebasReglas();
+        pruebasConjuntoReglas();
+        pruebasDinero();
+        pruebasEstrategiaBasica();
+        pruebasProbabilidadCrupier();
+        pruebasSolverEV();
+        pruebasSimulador();
 
         cout << "\n========================================" << endl;
         cout << "           RESULTADOS FINALES" << endl;
@@ -0,0 +1,61 @@
+#include "Reglas.h"
+using namespace std;
+
+/**
+ * El crupier debe pedir carta si tiene menos de 17; una consulta por estado
+ */
+bool Reglas::crupierDebePedir(const Mano& manoCrupier) {
+    return PIDE_CRUPIER[manoCrupier.obtenerEstado()];
+}
+
+/**
+ * Compara dos manos según las reglas de Blackjack
+ * Retorna: 1 = jugador gana, 0 = empate, -1 = crupier gana
+ */
+int Reglas::compararManos(const Mano& manoJugador, const Mano& manoCrupier, bool manoDividida) {
+    // Si el jugador se pasó, pierde
+    if (manoJugador.sePaso()) {
+        return -1;
+    }
+
+    // Si el crupier se pasó y el jugador no, el jugador gana
+    if (manoCrupier.sePaso()) {
+        return 1;
+    }
+
+    bool blackjackJugador = manoJugador.esBlackjack() && !manoDividida;
+    bool blackjackCrupier = manoCrupier.esBlackjack();
+
+    // Si ambos tienen Blackjack es empate; si solo uno lo tiene, gana
+    if (blackjackJugador || blackjackCrupier) {
+        return blackjackJugador - blackjackCrupier;
+    }
+
+    // Comparar valores
+    int valorJugador = manoJugador.calcularValor();
+    int valorCrupier = manoCrupier.calcularValor();
+    return (valorJugador > valorCrupier) - (valorJugador < valorCrupier);
+}
+
+/**
+ * Calcula el pago por Blackjack (3:2); la fracción de centavo queda para la casa
+ */
+Centavos Reglas::calcularPagoBlackjack(Centavos apuesta) {
+    Centavos pago = 0;
+    Dinero::aplicarProporcion(apuesta, PAGO_BLACKJACK_NUMERADOR, PAGO_BLACKJACK_DENOMINADOR, pago);
+    return pago;
+}
+
+/**
+ * Calcula el retorno total de una apuesta liquidada
+ * Victoria: apuesta + ganancia; empate: apuesta; derrota: nada
+ */
+Centavos Reglas::calcularRetorno(int resultado, bool esBlackjack, Centavos apuesta) {
+    if (resultado > 0) {
+        return apuesta + (esBlackjack ? calcularPagoBlackjack(apuesta) : apuesta);
+    }
+    if (resultado == 0) {
+        return apuesta;
+    }
+    return 0;
+}
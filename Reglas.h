@@ -0,0 +1,70 @@
+#ifndef REGLAS_H
+#define REGLAS_H
+
+#include "Dinero.h"
+#include "Mano.h"
+using namespace std;
+
+/**
+ * @class Reglas
+ * @brief Reúne las reglas del Blackjack compartidas por el juego y el simulador
+ *
+ * Esta clase concentra la regla de pedir del crupier, la comparación de
+ * manos y los pagos, para que la partida en consola y la simulación sin
+ * interfaz apliquen exactamente la misma lógica.
+ */
+class Reglas {
+public:
+    static constexpr int PLANTARSE_CRUPIER = 17;  ///< El crupier se planta con 17 o más
+    static constexpr array<bool, EstadoMano::NUM_ESTADOS> PIDE_CRUPIER =
+        EstadoMano::construirTablaCrupier(PLANTARSE_CRUPIER);  ///< Decisión del crupier por estado
+    static constexpr int64_t PAGO_BLACKJACK_NUMERADOR = 3;    ///< El Blackjack paga 3:2
+    static constexpr int64_t PAGO_BLACKJACK_DENOMINADOR = 2;
+    static constexpr double FACTOR_PAGO_BLACKJACK =
+        static_cast<double>(PAGO_BLACKJACK_NUMERADOR) / PAGO_BLACKJACK_DENOMINADOR;  ///< Para valores esperados
+
+    /**
+     * @brief Decide si el crupier de la mesa estándar (S17) debe pedir otra carta
+     * @param manoCrupier Mano actual del crupier
+     * @return true si el valor de la mano es menor a 17
+     * @note Con otra variante decide Crupier::quiereOtraCarta o la tabla
+     *       PIDE_CRUPIER del conjunto de reglas
+     */
+    static bool crupierDebePedir(const Mano& manoCrupier);
+
+    /**
+     * @brief Decide si el crupier debe pedir en un estado de mano
+     * @param estado Estado de la mano del crupier (ver EstadoMano)
+     * @return true si el crupier pide en ese estado
+     */
+    static bool crupierDebePedirEnEstado(uint8_t estado) { return PIDE_CRUPIER[estado]; }
+
+    /**
+     * @brief Compara la mano de un jugador con la del crupier
+     * @param manoJugador Mano del jugador
+     * @param manoCrupier Mano final del crupier
+     * @param manoDividida true si la mano viene de dividir; su 21 con dos cartas no es Blackjack
+     * @return 1 si gana el jugador, 0 si empate, -1 si gana el crupier
+     */
+    static int compararManos(const Mano& manoJugador, const Mano& manoCrupier, bool manoDividida = false);
+
+    /**
+     * @brief Calcula el pago por Blackjack (3:2), redondeado hacia abajo al centavo
+     * @param apuesta Apuesta original en centavos
+     * @return Cantidad a pagar por Blackjack, sin la apuesta
+     * @pre 0 <= apuesta <= Dinero::APUESTA_MAXIMA
+     */
+    static Centavos calcularPagoBlackjack(Centavos apuesta);
+
+    /**
+     * @brief Calcula cuánto recibe el jugador al liquidar su apuesta
+     * @param resultado Resultado de compararManos()
+     * @param esBlackjack true si la mano del jugador es Blackjack
+     * @param apuesta Apuesta original en centavos (ya descontada del dinero del jugador)
+     * @return Cantidad devuelta al jugador, incluida la apuesta si corresponde
+     * @pre 0 <= apuesta <= Dinero::APUESTA_MAXIMA
+     */
+    static Centavos calcularRetorno(int resultado, bool esBlackjack, Centavos apuesta);
+};
+
+#endif // REGLAS_H
@@ -0,0 +1,302 @@
+#include "SalidaJuego.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <streambuf>
+#include <thread>
+#include <vector>
+using namespace std;
+
+namespace {
+    constexpr size_t TAMANO_BLOQUE = 1 << 16;   // Buffer del modo BUFFER
+    constexpr size_t TAMANO_LOCAL = 1 << 12;    // Buffer del productor en modo ASINCRONA
+    constexpr size_t CAPACIDAD_ANILLO = 1 << 20;
+
+    /**
+     * Reenvía al destino y lo vacía al terminar cada línea (comportamiento de endl)
+     */
+    class BufferLinea : public streambuf {
+    private:
+        streambuf* destino;
+
+    public:
+        explicit BufferLinea(streambuf* destino) : destino(destino) {}
+
+    protected:
+        int_type overflow(int_type c) override {
+            if (traits_type::eq_int_type(c, traits_type::eof())) {
+                return traits_type::not_eof(c);
+            }
+            if (traits_type::eq_int_type(destino->sputc(traits_type::to_char_type(c)), traits_type::eof())) {
+                return traits_type::eof();
+            }
+            if (c == '\n') {
+                destino->pubsync();
+            }
+            return c;
+        }
+
+        streamsize xsputn(const char* datos, streamsize cantidad) override {
+            streamsize escritos = destino->sputn(datos, cantidad);
+            if (memchr(datos, '\n', static_cast<size_t>(cantidad)) != nullptr) {
+                destino->pubsync();
+            }
+            return escritos;
+        }
+
+        int sync() override {
+            return destino->pubsync();
+        }
+    };
+
+    /**
+     * Acumula el texto y lo escribe al destino solo cuando el bloque se llena
+     * o se vacía explícitamente
+     */
+    class BufferBloque : public streambuf {
+    private:
+        streambuf* destino;
+        vector<char> bloque;
+
+        bool volcar() {
+            streamsize pendiente = pptr() - pbase();
+            bool correcto = pendiente == 0 || destino->sputn(pbase(), pendiente) == pendiente;
+            setp(bloque.data(), bloque.data() + bloque.size());
+            return correcto;
+        }
+
+    public:
+        explicit BufferBloque(streambuf* destino) : destino(destino), bloque(TAMANO_BLOQUE) {
+            setp(bloque.data(), bloque.data() + bloque.size());
+        }
+
+        ~BufferBloque() override {
+            sync();
+        }
+
+    protected:
+        int_type overflow(int_type c) override {
+            if (!volcar()) {
+                return traits_type::eof();
+            }
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(c);
+                pbump(1);
+            }
+            return traits_type::not_eof(c);
+        }
+
+        int sync() override {
+            return (volcar() && destino->pubsync() == 0) ? 0 : -1;
+        }
+    };
+
+    /**
+     * Descarta todo lo que recibe
+     */
+    class BufferNulo : public streambuf {
+    protected:
+        int_type overflow(int_type c) override {
+            return traits_type::not_eof(c);
+        }
+
+        streamsize xsputn(const char*, streamsize cantidad) override {
+            return cantidad;
+        }
+    };
+
+    /**
+     * Anillo de bytes de un productor y un consumidor, sin bloqueos
+     * Los contadores crecen sin límite; la posición real es contador & máscara
+     */
+    class AnilloBytes {
+    private:
+        unique_ptr<char[]> datos;
+        size_t mascara;
+        alignas(64) atomic<size_t> escritos{0};  // Solo lo modifica el productor
+        alignas(64) atomic<size_t> leidos{0};    // Solo lo modifica el consumidor
+
+    public:
+        explicit AnilloBytes(size_t capacidad)
+            : datos(make_unique<char[]>(capacidad)), mascara(capacidad - 1) {}
+
+        /**
+         * Copia hasta cantidad bytes; retorna cuántos cupieron
+         */
+        size_t escribir(const char* origen, size_t cantidad) {
+            size_t e = escritos.load(memory_order_relaxed);
+            size_t libres = (mascara + 1) - (e - leidos.load(memory_order_acquire));
+            size_t n = min(cantidad, libres);
+            size_t inicio = e & mascara;
+            size_t primero = min(n, mascara + 1 - inicio);
+            memcpy(datos.get() + inicio, origen, primero);
+            memcpy(datos.get(), origen + primero, n - primero);
+            escritos.store(e + n, memory_order_release);
+            return n;
+        }
+
+        /**
+         * Copia hasta maximo bytes disponibles; retorna cuántos se leyeron
+         */
+        size_t leer(char* destino, size_t maximo) {
+            size_t l = leidos.load(memory_order_relaxed);
+            size_t n = min(maximo, escritos.load(memory_order_acquire) - l);
+            size_t inicio = l & mascara;
+            size_t primero = min(n, mascara + 1 - inicio);
+            memcpy(destino, datos.get() + inicio, primero);
+            memcpy(destino + primero, datos.get(), n - primero);
+            leidos.store(l + n, memory_order_release);
+            return n;
+        }
+    };
+
+    /**
+     * El hilo del juego escribe en un buffer local que se pasa al anillo;
+     * un hilo escritor vacía el anillo hacia el destino
+     */
+    class BufferAsincrono : public streambuf {
+    private:
+        streambuf* destino;
+        AnilloBytes anillo;
+        char local[TAMANO_LOCAL];
+        size_t producidos = 0;                 // Bytes pasados al anillo (productor)
+        atomic<size_t> confirmados{0};         // Bytes ya escritos y vaciados en el destino
+        atomic<bool> detener{false};
+        thread escritor;
+
+        void enviar(const char* origen, size_t cantidad) {
+            while (cantidad > 0) {
+                size_t n = anillo.escribir(origen, cantidad);
+                if (n == 0) {
+                    this_thread::yield();  // Anillo lleno: esperar al escritor
+                    continue;
+                }
+                origen += n;
+                cantidad -= n;
+                producidos += n;
+            }
+        }
+
+        void enviarLocal() {
+            enviar(pbase(), static_cast<size_t>(pptr() - pbase()));
+            setp(local, local + TAMANO_LOCAL);
+        }
+
+        void ejecutarEscritor() {
+            char tramo[TAMANO_LOCAL];
+            size_t escritos = 0;
+            for (;;) {
+                size_t n = anillo.leer(tramo, sizeof(tramo));
+                if (n > 0) {
+                    destino->sputn(tramo, static_cast<streamsize>(n));
+                    escritos += n;
+                } else if (escritos != confirmados.load(memory_order_relaxed)) {
+                    destino->pubsync();
+                    confirmados.store(escritos, memory_order_release);
+                } else if (detener.load(memory_order_acquire)) {
+                    return;
+                } else {
+                    this_thread::sleep_for(chrono::microseconds(200));
+                }
+            }
+        }
+
+    public:
+        explicit BufferAsincrono(streambuf* destino)
+            : destino(destino), anillo(CAPACIDAD_ANILLO) {
+            setp(local, local + TAMANO_LOCAL);
+            escritor = thread(&BufferAsincrono::ejecutarEscritor, this);
+        }
+
+        ~BufferAsincrono() override {
+            sync();
+            detener.store(true, memory_order_release);
+            escritor.join();
+        }
+
+    protected:
+        int_type overflow(int_type c) override {
+            enviarLocal();
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(c);
+                pbump(1);
+            }
+            return traits_type::not_eof(c);
+        }
+
+        /**
+         * Espera a que el escritor haya vaciado todo lo enviado
+         */
+        int sync() override {
+            enviarLocal();
+            while (confirmados.load(memory_order_acquire) != producidos) {
+                this_thread::yield();
+            }
+            return 0;
+        }
+    };
+
+    /**
+     * Salida concreta que posee su streambuf
+     */
+    template <typename Buffer, ModoSalida MODO>
+    class SalidaConBuffer : public SalidaJuego {
+    private:
+        Buffer buffer;
+
+    public:
+        template <typename... Argumentos>
+        explicit SalidaConBuffer(Argumentos&&... argumentos)
+            : buffer(forward<Argumentos>(argumentos)...) {
+            rdbuf(&buffer);
+        }
+
+        ~SalidaConBuffer() override {
+            flush();
+        }
+
+        ModoSalida obtenerModo() const override {
+            return MODO;
+        }
+    };
+
+    using SalidaInteractiva = SalidaConBuffer<BufferLinea, ModoSalida::INTERACTIVA>;
+    using SalidaBuffer = SalidaConBuffer<BufferBloque, ModoSalida::BUFFER>;
+    using SalidaAsincrona = SalidaConBuffer<BufferAsincrono, ModoSalida::ASINCRONA>;
+
+    /**
+     * Salida nula: el estado de error hace que los operadores << no den formato
+     */
+    class SalidaNula : public SalidaConBuffer<BufferNulo, ModoSalida::NULA> {
+    public:
+        SalidaNula() {
+            setstate(ios_base::badbit);
+        }
+    };
+}
+
+/**
+ * Fábrica de salidas según el modo
+ */
+unique_ptr<SalidaJuego> SalidaJuego::crear(ModoSalida modo, ostream& destino) {
+    switch (modo) {
+        case ModoSalida::BUFFER:
+            return make_unique<SalidaBuffer>(destino.rdbuf());
+        case ModoSalida::NULA:
+            return make_unique<SalidaNula>();
+        case ModoSalida::ASINCRONA:
+            return make_unique<SalidaAsincrona>(destino.rdbuf());
+        case ModoSalida::INTERACTIVA:
+        default:
+            return make_unique<SalidaInteractiva>(destino.rdbuf());
+    }
+}
+
+/**
+ * Salida interactiva compartida sobre cout
+ */
+SalidaJuego& SalidaJuego::consola() {
+    static SalidaInteractiva salida(cout.rdbuf());
+    return salida;
+}
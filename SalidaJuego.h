@@ -0,0 +1,64 @@
+#ifndef SALIDA_JUEGO_H
+#define SALIDA_JUEGO_H
+
+#include <iostream>
+#include <memory>
+using namespace std;
+
+/**
+ * @enum ModoSalida
+ * @brief Estrategias para llevar el texto del juego a su destino
+ */
+enum class ModoSalida {
+    INTERACTIVA,  ///< Escribe directo y vacía al final de cada línea
+    BUFFER,       ///< Acumula en un buffer grande y escribe por bloques
+    NULA,         ///< Descarta todo sin dar formato (simulaciones y pruebas)
+    ASINCRONA     ///< Un hilo escritor vacía un anillo sin bloqueos
+};
+
+/**
+ * @class SalidaJuego
+ * @brief Destino de toda la salida de texto del juego
+ *
+ * Es un ostream, por lo que las clases del juego escriben con los mismos
+ * operadores que usarían con cout. El modo decide cuándo y cómo llega el
+ * texto al flujo de destino; flush() garantiza que todo lo escrito hasta
+ * ese momento ya es visible, y debe llamarse antes de leer de la consola.
+ */
+class SalidaJuego : public ostream {
+protected:
+    /**
+     * @brief Constructor para las implementaciones concretas
+     * @post El streambuf lo asigna la clase derivada con rdbuf()
+     */
+    SalidaJuego() : ostream(nullptr) {}
+
+public:
+    /**
+     * @brief Destructor virtual; las implementaciones vacían lo pendiente
+     */
+    virtual ~SalidaJuego() = default;
+
+    /**
+     * @brief Obtiene el modo de la salida
+     * @return Modo con que se creó
+     */
+    virtual ModoSalida obtenerModo() const = 0;
+
+    /**
+     * @brief Crea una salida del modo indicado
+     * @param modo Modo de salida
+     * @param destino Flujo donde termina el texto (no se usa en modo NULA)
+     * @return Salida nueva
+     * @pre destino debe vivir más que la salida creada
+     */
+    static unique_ptr<SalidaJuego> crear(ModoSalida modo, ostream& destino = cout);
+
+    /**
+     * @brief Salida interactiva compartida sobre cout
+     * @return Salida usada por las clases a las que no se les asignó otra
+     */
+    static SalidaJuego& consola();
+};
+
+#endif // SALIDA_JUEGO_H
@@ -0,0 +1,694 @@
+#include "ServidorMesas.h"
+#include "ControladorJuego.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+using namespace std;
+
+namespace {
+    constexpr int MAX_EVENTOS = 64;               // Eventos por llamada a epoll_wait
+    constexpr size_t TAMANO_LECTURA = 4096;       // Bytes por llamada a recv
+    constexpr size_t MAX_LINEA = 4096;            // Línea más larga aceptada
+    constexpr size_t MAX_SALIDA = 1 << 20;        // Salida pendiente antes de cortar a un cliente lento
+    constexpr int MAX_ASIENTOS_MESA = 7;          // Asientos por mesa
+
+    /**
+     * Estado de una conexión de cliente
+     */
+    struct Conexion {
+        int descriptor;
+        string entrada;                  // Bytes recibidos sin procesar
+        string salida;                   // Bytes que el socket aún no aceptó
+        string nombre;
+        int mesa = -1;
+        int asiento = -1;
+        bool cerrar = false;
+        bool esperandoEscritura = false; // EPOLLOUT activo
+
+        explicit Conexion(int descriptor) : descriptor(descriptor) {}
+    };
+
+    /**
+     * Mesa y conexiones sentadas en ella
+     * El texto del controlador se acumula en 'texto', que se declara antes
+     * para que el controlador lo vacíe al destruirse
+     */
+    struct MesaLocal {
+        ostringstream texto;                // Salida de la mesa desde la última difusión
+        unique_ptr<ControladorJuego> mesa;
+        vector<Conexion*> conexiones;
+        vector<uint8_t> levantados;         // Asientos cuyo jugador se fue con la ronda en curso
+        vector<Conexion*> esperando;        // Llegadas que se sientan al terminar la ronda
+        vector<Conexion*> sentados;         // Llegadas sentadas que aún no recibieron "OK"
+        vector<Conexion*> rechazados;       // Llegadas que no cupieron en la mesa
+        string avisos;                      // Líneas del protocolo por difundir tras el texto
+
+        MesaLocal()
+            : mesa(make_unique<ControladorJuego>(6, 0.75, ModoSalida::INTERACTIVA,
+                                                 MAX_ASIENTOS_MESA, texto)) {
+            // El crupier no debe esperar en el hilo del trabajador
+            mesa->establecerRitmo(ModoRitmo::SIN_RETARDO, chrono::milliseconds(0));
+            levantados.assign(static_cast<size_t>(mesa->obtenerAsientos().numAsientos()), 0);
+        }
+    };
+
+    /**
+     * Comando del protocolo y la respuesta que entrega a la ronda
+     */
+    struct ComandoMesa {
+        const char* palabra;
+        TipoSolicitud tipo;     // Solicitud que debe estar pendiente
+        const char* respuesta;  // Vacía si la respuesta es el argumento del comando
+    };
+
+    constexpr ComandoMesa COMANDOS[] = {
+        {"APOSTAR", TipoSolicitud::APUESTA, ""},
+        {"PEDIR", TipoSolicitud::DECISION, "s"},
+        {"PLANTARSE", TipoSolicitud::DECISION, "n"},
+        {"DOBLAR", TipoSolicitud::DECISION, "d"},
+        {"DIVIDIR", TipoSolicitud::DECISION, "v"},
+        {"RENDIRSE", TipoSolicitud::DECISION, "r"},
+        {"SEGURO", TipoSolicitud::SEGURO, "s"},
+        {"NO_SEGURO", TipoSolicitud::SEGURO, "n"},
+    };
+
+    /**
+     * Nombre con el que "TURNO" anuncia cada solicitud a los jugadores
+     */
+    const char* nombreSolicitud(TipoSolicitud tipo) {
+        switch (tipo) {
+            case TipoSolicitud::APUESTA: return "APUESTA";
+            case TipoSolicitud::SEGURO:  return "SEGURO";
+            default:                     return "DECISION";
+        }
+    }
+
+    /**
+     * Asiento al que va una solicitud: la apuesta y el seguro piden una posición
+     */
+    int asientoSolicitud(const ControladorJuego& mesa, const SolicitudEntrada& solicitud) {
+        if (solicitud.tipo == TipoSolicitud::APUESTA || solicitud.tipo == TipoSolicitud::SEGURO) {
+            return mesa.obtenerAsientos().obtenerAsiento(solicitud.asiento);
+        }
+        return solicitud.asiento;
+    }
+
+    /**
+     * Verifica si alguien sentado puede apostar; si no, abrir una ronda no
+     * esperaría a nadie
+     */
+    bool hayApostadores(const ControladorJuego& mesa) {
+        const Asientos& asientos = mesa.obtenerAsientos();
+        for (int posicion = 0; posicion < asientos.numPosiciones(); posicion++) {
+            if (asientos.obtenerDinero(posicion) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Sienta a quienes llegaron durante la ronda; la ronda suspendida guarda
+     * referencias a los datos de los asientos, así que solo se agregan
+     * jugadores entre rondas
+     */
+    void sentarEsperando(MesaLocal& local) {
+        for (Conexion* conexion : local.esperando) {
+            int posicion = local.mesa->agregarJugador(conexion->nombre);
+            if (posicion < 0) {
+                local.rechazados.push_back(conexion);
+                continue;
+            }
+            conexion->asiento = local.mesa->obtenerAsientos().obtenerAsiento(posicion);
+            local.conexiones.push_back(conexion);
+            local.sentados.push_back(conexion);
+            local.avisos += "ASIENTO " + to_string(conexion->asiento) + " " + conexion->nombre + "\n";
+        }
+        local.esperando.clear();
+    }
+
+    /**
+     * Lleva la ronda hasta que espere a un jugador conectado: emite las
+     * líneas del crupier, responde por quienes se fueron (no apuestan, no se
+     * aseguran y se plantan), al terminar la ronda los levanta y sienta a
+     * quienes llegaron, y abre la siguiente. Anuncia a quién espera la mesa
+     */
+    void avanzar(MesaLocal& local) {
+        ControladorJuego& mesa = *local.mesa;
+        for (;;) {
+            if (mesa.rondaTerminada()) {
+                for (size_t asiento = 0; asiento < local.levantados.size(); asiento++) {
+                    if (local.levantados[asiento]) {
+                        mesa.levantarJugador(static_cast<int>(asiento));
+                        local.levantados[asiento] = 0;
+                    }
+                }
+                sentarEsperando(local);
+                if (!hayApostadores(mesa)) {
+                    return;
+                }
+                mesa.comenzarRonda();
+                continue;
+            }
+
+            const SolicitudEntrada& solicitud = mesa.solicitudPendiente();
+            if (solicitud.tipo == TipoSolicitud::PRESENTACION) {
+                mesa.obtenerPresentador().drenar();
+                mesa.entregarEntrada("");
+                continue;
+            }
+            int asiento = asientoSolicitud(mesa, solicitud);
+            if (local.levantados[asiento]) {
+                mesa.entregarEntrada(solicitud.tipo == TipoSolicitud::APUESTA ? "0" : "n");
+                continue;
+            }
+            local.avisos += "TURNO " + to_string(asiento) + " " + nombreSolicitud(solicitud.tipo) + "\n";
+            return;
+        }
+    }
+
+    /**
+     * Traduce un comando del protocolo a la respuesta que espera la ronda
+     * Retorna el motivo del rechazo, o vacío si se entregó
+     */
+    string procesarComando(MesaLocal& local, int asiento, const string& comando) {
+        ControladorJuego& mesa = *local.mesa;
+        stringstream ss(comando);
+        string palabra;
+        ss >> palabra;
+
+        const ComandoMesa* encontrado = nullptr;
+        for (const ComandoMesa& candidato : COMANDOS) {
+            if (palabra == candidato.palabra) {
+                encontrado = &candidato;
+                break;
+            }
+        }
+        if (!encontrado) {
+            return "Comando desconocido";
+        }
+        string respuesta = encontrado->respuesta;
+        if (respuesta.empty() && !(ss >> respuesta)) {
+            return "Falta la cantidad";
+        }
+
+        // Una opción no disponible la rechaza la ronda y vuelve a pedir la decisión
+        const SolicitudEntrada& solicitud = mesa.solicitudPendiente();
+        if (mesa.rondaTerminada() || solicitud.tipo != encontrado->tipo ||
+            asientoSolicitud(mesa, solicitud) != asiento) {
+            return "No es tu turno";
+        }
+        mesa.entregarEntrada(respuesta);
+        avanzar(local);
+        return "";
+    }
+}
+
+/**
+ * Un hilo trabajador: su epoll, sus conexiones y las mesas que le tocan
+ */
+struct ServidorMesas::Trabajador {
+    ServidorMesas* servidor;
+    size_t indice;
+    int epoll;
+    int despertador;                                    // eventfd para entregas y parada
+    thread hilo;
+    mutex mutexEntrantes;
+    vector<unique_ptr<Conexion>> entrantes;             // Conexiones entregadas por otros hilos
+    unordered_map<int, unique_ptr<Conexion>> conexiones;
+    unordered_map<int, MesaLocal> mesas;
+    vector<int> porCerrar;
+
+    Trabajador(ServidorMesas* servidor, size_t indice)
+        : servidor(servidor), indice(indice),
+          epoll(epoll_create1(EPOLL_CLOEXEC)),
+          despertador(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+        epoll_event evento{};
+        evento.events = EPOLLIN;
+        evento.data.fd = despertador;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, despertador, &evento);
+    }
+
+    ~Trabajador() {
+        for (auto& par : conexiones) {
+            close(par.first);
+        }
+        for (auto& conexion : entrantes) {
+            close(conexion->descriptor);
+        }
+        close(despertador);
+        close(epoll);
+    }
+
+    void despertar() {
+        uint64_t uno = 1;
+        ssize_t escritos = write(despertador, &uno, sizeof(uno));
+        (void)escritos;
+    }
+
+    void registrar(Conexion& conexion) {
+        epoll_event evento{};
+        evento.events = EPOLLIN | (conexion.esperandoEscritura ? uint32_t(EPOLLOUT) : 0u);
+        evento.data.fd = conexion.descriptor;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, conexion.descriptor, &evento);
+    }
+
+    void marcarCierre(Conexion& conexion) {
+        if (!conexion.cerrar) {
+            conexion.cerrar = true;
+            porCerrar.push_back(conexion.descriptor);
+        }
+    }
+
+    void cambiarInteres(Conexion& conexion, bool escritura) {
+        conexion.esperandoEscritura = escritura;
+        epoll_event evento{};
+        evento.events = EPOLLIN | (escritura ? uint32_t(EPOLLOUT) : 0u);
+        evento.data.fd = conexion.descriptor;
+        epoll_ctl(epoll, EPOLL_CTL_MOD, conexion.descriptor, &evento);
+    }
+
+    /**
+     * Escribe lo pendiente; lo que el socket no acepta se queda en salida
+     */
+    void vaciarSalida(Conexion& conexion) {
+        size_t enviados = 0;
+        while (enviados < conexion.salida.size()) {
+            ssize_t n = send(conexion.descriptor, conexion.salida.data() + enviados,
+                             conexion.salida.size() - enviados, MSG_NOSIGNAL);
+            if (n > 0) {
+                enviados += static_cast<size_t>(n);
+            } else if (n < 0 && errno == EINTR) {
+                continue;
+            } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            } else {
+                marcarCierre(conexion);
+                return;
+            }
+        }
+        conexion.salida.erase(0, enviados);
+        if (conexion.salida.empty() == conexion.esperandoEscritura) {
+            cambiarInteres(conexion, !conexion.salida.empty());
+        }
+    }
+
+    void enviar(Conexion& conexion, const string& texto) {
+        if (conexion.cerrar || texto.empty()) return;
+        conexion.salida += texto;
+        if (conexion.salida.size() > MAX_SALIDA) {
+            marcarCierre(conexion);
+            return;
+        }
+        vaciarSalida(conexion);
+    }
+
+    /**
+     * Responde a las llegadas que la mesa sentó o rechazó y envía a toda la
+     * mesa su texto nuevo, una línea "TEXTO" por línea (la pregunta que
+     * queda sin salto de línea también), y después los avisos
+     */
+    void difundir(MesaLocal& local) {
+        for (Conexion* conexion : local.sentados) {
+            enviar(*conexion, "OK " + to_string(conexion->asiento) + "\n");
+        }
+        local.sentados.clear();
+        for (Conexion* conexion : local.rechazados) {
+            conexion->mesa = -1;
+            enviar(*conexion, "ERROR Mesa llena\n");
+            marcarCierre(*conexion);
+        }
+        local.rechazados.clear();
+
+        string texto = local.texto.str();
+        local.texto.str("");
+        string eventos;
+        size_t inicio = 0;
+        while (inicio < texto.size()) {
+            size_t fin = texto.find('\n', inicio);
+            if (fin == string::npos) {
+                fin = texto.size();
+            }
+            eventos += "TEXTO " + texto.substr(inicio, fin - inicio) + "\n";
+            inicio = fin + 1;
+        }
+        eventos += local.avisos;
+        local.avisos.clear();
+        for (Conexion* conexion : local.conexiones) {
+            enviar(*conexion, eventos);
+        }
+    }
+
+    /**
+     * Lleva la conexión a su mesa, creando la mesa si es la primera vez
+     * Entre rondas se sienta en seguida y abre la ronda; con una en curso
+     * espera a que termine para recibir "OK"
+     */
+    void unirse(Conexion& conexion) {
+        MesaLocal& local = mesas[conexion.mesa];
+        local.esperando.push_back(&conexion);
+        if (local.mesa->rondaTerminada()) {
+            avanzar(local);
+            difundir(local);
+        }
+    }
+
+    /**
+     * Procesa las líneas completas; retorna false si la conexión se entregó
+     * a otro trabajador
+     */
+    bool procesarLineas(Conexion& conexion) {
+        size_t inicio = 0;
+        size_t fin;
+        while (!conexion.cerrar && (fin = conexion.entrada.find('\n', inicio)) != string::npos) {
+            string linea = conexion.entrada.substr(inicio, fin - inicio);
+            inicio = fin + 1;
+            if (!linea.empty() && linea.back() == '\r') {
+                linea.pop_back();
+            }
+
+            if (conexion.mesa < 0) {
+                stringstream ss(linea);
+                string palabra;
+                int mesa = -1;
+                ss >> palabra >> mesa;
+                getline(ss >> ws, conexion.nombre);
+                if (palabra != "MESA" || mesa < 0 || mesa >= servidor->numMesas || conexion.nombre.empty()) {
+                    enviar(conexion, "ERROR Se esperaba MESA <n> <nombre>\n");
+                    continue;
+                }
+                conexion.mesa = mesa;
+
+                size_t destino = static_cast<size_t>(mesa) % servidor->trabajadores.size();
+                if (destino != indice) {
+                    conexion.entrada.erase(0, inicio);
+                    entregar(conexion, *servidor->trabajadores[destino]);
+                    return false;
+                }
+                unirse(conexion);
+                continue;
+            }
+
+            if (linea == "SALIR") {
+                marcarCierre(conexion);
+                break;
+            }
+            MesaLocal& local = mesas[conexion.mesa];
+            string error = procesarComando(local, conexion.asiento, linea);
+            if (!error.empty()) {
+                enviar(conexion, "ERROR " + error + "\n");
+            }
+            difundir(local);
+        }
+
+        conexion.entrada.erase(0, inicio);
+        if (conexion.entrada.size() > MAX_LINEA) {
+            marcarCierre(conexion);
+        }
+        return true;
+    }
+
+    /**
+     * Pasa la conexión al trabajador dueño de su mesa
+     */
+    void entregar(Conexion& conexion, Trabajador& destino) {
+        int descriptor = conexion.descriptor;
+        epoll_ctl(epoll, EPOLL_CTL_DEL, descriptor, nullptr);
+        unique_ptr<Conexion> propia = move(conexiones[descriptor]);
+        conexiones.erase(descriptor);
+        {
+            lock_guard<mutex> bloqueo(destino.mutexEntrantes);
+            destino.entrantes.push_back(move(propia));
+        }
+        destino.despertar();
+    }
+
+    void adoptarEntrantes() {
+        uint64_t contador;
+        ssize_t leidos = read(despertador, &contador, sizeof(contador));
+        (void)leidos;
+
+        vector<unique_ptr<Conexion>> nuevas;
+        {
+            lock_guard<mutex> bloqueo(mutexEntrantes);
+            nuevas.swap(entrantes);
+        }
+        for (auto& nueva : nuevas) {
+            Conexion& conexion = *nueva;
+            conexiones[conexion.descriptor] = move(nueva);
+            registrar(conexion);
+            unirse(conexion);
+            procesarLineas(conexion);
+        }
+    }
+
+    void aceptar(int escucha) {
+        for (;;) {
+            int descriptor = accept4(escucha, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (descriptor < 0) {
+                if (errno == EINTR) continue;
+                return;  // EAGAIN: otro trabajador ya aceptó, o no hay más
+            }
+            int activado = 1;
+            setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &activado, sizeof(activado));  // Falla sin efecto en UNIX
+            auto conexion = make_unique<Conexion>(descriptor);
+            registrar(*conexion);
+            conexiones[descriptor] = move(conexion);
+        }
+    }
+
+    void leer(Conexion& conexion) {
+        char buffer[TAMANO_LECTURA];
+        for (;;) {
+            ssize_t n = recv(conexion.descriptor, buffer, sizeof(buffer), 0);
+            if (n > 0) {
+                conexion.entrada.append(buffer, static_cast<size_t>(n));
+            } else if (n < 0 && errno == EINTR) {
+                continue;
+            } else {
+                if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                    marcarCierre(conexion);
+                }
+                break;
+            }
+        }
+        procesarLineas(conexion);
+    }
+
+    /**
+     * Cierra las conexiones marcadas; levantar a un jugador puede marcar otras
+     */
+    void cerrarPendientes() {
+        for (size_t i = 0; i < porCerrar.size(); i++) {
+            auto it = conexiones.find(porCerrar[i]);
+            if (it == conexiones.end()) continue;
+            Conexion& conexion = *it->second;
+
+            if (conexion.mesa >= 0 && conexion.asiento < 0) {
+                MesaLocal& local = mesas[conexion.mesa];
+                local.esperando.erase(remove(local.esperando.begin(), local.esperando.end(), &conexion),
+                                      local.esperando.end());
+            } else if (conexion.mesa >= 0) {
+                MesaLocal& local = mesas[conexion.mesa];
+                local.conexiones.erase(remove(local.conexiones.begin(), local.conexiones.end(), &conexion),
+                                       local.conexiones.end());
+                // Con la ronda en curso el asiento se libera al terminarla
+                local.levantados[conexion.asiento] = 1;
+                local.avisos += "SALE " + to_string(conexion.asiento) + "\n";
+                avanzar(local);
+                difundir(local);
+            }
+            epoll_ctl(epoll, EPOLL_CTL_DEL, conexion.descriptor, nullptr);
+            close(conexion.descriptor);
+            conexiones.erase(it);
+        }
+        porCerrar.clear();
+    }
+
+    void ejecutar() {
+        epoll_event eventos[MAX_EVENTOS];
+        while (servidor->enEjecucion.load(memory_order_acquire)) {
+            int n = epoll_wait(epoll, eventos, MAX_EVENTOS, -1);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            for (int i = 0; i < n; i++) {
+                int descriptor = eventos[i].data.fd;
+                if (descriptor == despertador) {
+                    adoptarEntrantes();
+                    continue;
+                }
+                const vector<int>& escuchas = servidor->socketsEscucha;
+                if (find(escuchas.begin(), escuchas.end(), descriptor) != escuchas.end()) {
+                    aceptar(descriptor);
+                    continue;
+                }
+
+                auto it = conexiones.find(descriptor);
+                if (it == conexiones.end()) continue;  // Cerrada o entregada en este lote
+                Conexion& conexion = *it->second;
+                if (eventos[i].events & EPOLLOUT) {
+                    vaciarSalida(conexion);
+                }
+                if (eventos[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    leer(conexion);
+                }
+            }
+            cerrarPendientes();
+        }
+    }
+};
+
+/**
+ * Constructor que prepara un trabajador por hilo
+ */
+ServidorMesas::ServidorMesas(int numMesas, unsigned numTrabajadores)
+    : numMesas(max(1, numMesas)), puertoTcp(0), enEjecucion(true) {
+    if (numTrabajadores == 0) {
+        numTrabajadores = max(1u, thread::hardware_concurrency());
+    }
+    for (unsigned i = 0; i < numTrabajadores; i++) {
+        trabajadores.push_back(make_unique<Trabajador>(this, i));
+    }
+}
+
+/**
+ * Destructor que libera los sockets
+ */
+ServidorMesas::~ServidorMesas() {
+    detener();
+    for (auto& trabajador : trabajadores) {
+        if (trabajador->hilo.joinable()) {
+            trabajador->hilo.join();
+        }
+    }
+    trabajadores.clear();
+    for (int descriptor : socketsEscucha) {
+        close(descriptor);
+    }
+    if (!rutaUnix.empty()) {
+        unlink(rutaUnix.c_str());
+    }
+}
+
+/**
+ * Agrega el socket a todos los epoll; EPOLLEXCLUSIVE despierta a un solo
+ * trabajador por conexión nueva
+ */
+void ServidorMesas::registrarEscucha(int descriptor) {
+    socketsEscucha.push_back(descriptor);
+    for (auto& trabajador : trabajadores) {
+        epoll_event evento{};
+        evento.events = EPOLLIN | EPOLLEXCLUSIVE;
+        evento.data.fd = descriptor;
+        epoll_ctl(trabajador->epoll, EPOLL_CTL_ADD, descriptor, &evento);
+    }
+}
+
+/**
+ * Abre un socket TCP en 127.0.0.1
+ */
+bool ServidorMesas::escucharTcp(uint16_t puerto) {
+    int descriptor = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (descriptor < 0) {
+        return false;
+    }
+    int activado = 1;
+    setsockopt(descriptor, SOL_SOCKET, SO_REUSEADDR, &activado, sizeof(activado));
+
+    sockaddr_in direccion{};
+    direccion.sin_family = AF_INET;
+    direccion.sin_port = htons(puerto);
+    direccion.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t longitud = sizeof(direccion);
+    if (bind(descriptor, reinterpret_cast<sockaddr*>(&direccion), sizeof(direccion)) != 0 ||
+        listen(descriptor, SOMAXCONN) != 0 ||
+        getsockname(descriptor, reinterpret_cast<sockaddr*>(&direccion), &longitud) != 0) {
+        close(descriptor);
+        return false;
+    }
+    puertoTcp = ntohs(direccion.sin_port);
+    registrarEscucha(descriptor);
+    return true;
+}
+
+/**
+ * Abre un socket UNIX en la ruta indicada
+ */
+bool ServidorMesas::escucharUnix(const string& ruta) {
+    sockaddr_un direccion{};
+    if (ruta.empty() || ruta.size() >= sizeof(direccion.sun_path)) {
+        return false;
+    }
+    int descriptor = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (descriptor < 0) {
+        return false;
+    }
+    direccion.sun_family = AF_UNIX;
+    memcpy(direccion.sun_path, ruta.c_str(), ruta.size() + 1);
+    unlink(ruta.c_str());
+    if (bind(descriptor, reinterpret_cast<sockaddr*>(&direccion), sizeof(direccion)) != 0 ||
+        listen(descriptor, SOMAXCONN) != 0) {
+        close(descriptor);
+        return false;
+    }
+    rutaUnix = ruta;
+    registrarEscucha(descriptor);
+    return true;
+}
+
+/**
+ * Bucle de eventos del trabajador indicado
+ */
+void ServidorMesas::ejecutarTrabajador(size_t indice) {
+    trabajadores[indice]->ejecutar();
+}
+
+/**
+ * Lanza los trabajadores y espera a que terminen
+ */
+void ServidorMesas::ejecutar() {
+    for (size_t i = 0; i < trabajadores.size(); i++) {
+        trabajadores[i]->hilo = thread(&ServidorMesas::ejecutarTrabajador, this, i);
+    }
+    for (auto& trabajador : trabajadores) {
+        trabajador->hilo.join();
+    }
+}
+
+/**
+ * Marca la parada y despierta a todos los trabajadores
+ */
+void ServidorMesas::detener() {
+    enEjecucion.store(false, memory_order_release);
+    for (auto& trabajador : trabajadores) {
+        trabajador->despertar();
+    }
+}
+
+/**
+ * Getter del puerto TCP
+ */
+uint16_t ServidorMesas::obtenerPuertoTcp() const {
+    return puertoTcp;
+}
+
+/**
+ * Getter del número de trabajadores
+ */
+unsigned ServidorMesas::obtenerNumTrabajadores() const {
+    return static_cast<unsigned>(trabajadores.size());
+}
@@ -0,0 +1,114 @@
+#ifndef SERVIDOR_MESAS_H
+#define SERVIDOR_MESAS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * @class ServidorMesas
+ * @brief Servidor que aloja muchas mesas independientes en un solo proceso
+ *
+ * Los clientes se conectan por TCP local o por un socket UNIX y hablan un
+ * protocolo de líneas de texto. La primera línea elige la mesa
+ * ("MESA <n> <nombre>"); después se envían "APOSTAR <cantidad>", "PEDIR",
+ * "PLANTARSE", "DOBLAR", "DIVIDIR", "RENDIRSE", "SEGURO", "NO_SEGURO" y
+ * "SALIR". Cada mesa es un ControladorJuego: su texto llega a todos sus
+ * jugadores como líneas "TEXTO ..." y cada entrada que espera se anuncia con
+ * "TURNO <asiento> <APUESTA|DECISION|SEGURO>"; los comandos se entregan
+ * a la ronda como respuestas. Las llegadas y salidas se anuncian con
+ * "ASIENTO <n> <nombre>" y "SALE <n>", y los rechazos ("ERROR <motivo>") solo
+ * a quien envió el comando. Quien llega con una ronda en curso se sienta, y
+ * recibe "OK <asiento>", cuando esa ronda termina.
+ *
+ * Un grupo pequeño de hilos trabajadores atiende todas las conexiones: cada
+ * uno tiene su propio bucle epoll y es dueño de las mesas n con
+ * n % numTrabajadores igual a su índice. Una conexión aceptada por otro
+ * trabajador se le entrega al dueño de su mesa, de modo que cada mesa solo
+ * la toca un hilo y no necesita bloqueos. Las mesas se crean al llegar su
+ * primer jugador.
+ */
+class ServidorMesas {
+private:
+    struct Trabajador;  ///< Bucle epoll, conexiones y mesas de un hilo
+
+    int numMesas;                                   ///< Mesas disponibles (0 .. numMesas-1)
+    vector<unique_ptr<Trabajador>> trabajadores;    ///< Un trabajador por hilo
+    vector<int> socketsEscucha;                     ///< Sockets TCP/UNIX en escucha
+    string rutaUnix;                                ///< Ruta del socket UNIX, para borrarlo
+    uint16_t puertoTcp;                             ///< Puerto TCP real (0 si no hay)
+    atomic<bool> enEjecucion;                       ///< false para detener los bucles
+
+    /**
+     * @brief Registra un socket en escucha en el epoll de todos los trabajadores
+     * @param descriptor Socket en escucha
+     */
+    void registrarEscucha(int descriptor);
+
+    /**
+     * @brief Bucle de eventos de un trabajador
+     * @param indice Índice del trabajador
+     */
+    void ejecutarTrabajador(size_t indice);
+
+public:
+    /**
+     * @brief Constructor de la clase ServidorMesas
+     * @param numMesas Número de mesas que se pueden usar
+     * @param numTrabajadores Hilos trabajadores (0 = núcleos disponibles)
+     */
+    ServidorMesas(int numMesas = 1000, unsigned numTrabajadores = 0);
+
+    /**
+     * @brief Destructor; cierra los sockets y borra el socket UNIX
+     */
+    ~ServidorMesas();
+
+    ServidorMesas(const ServidorMesas&) = delete;
+    ServidorMesas& operator=(const ServidorMesas&) = delete;
+
+    /**
+     * @brief Escucha conexiones TCP en 127.0.0.1
+     * @param puerto Puerto (0 = elegir uno libre)
+     * @return true si el socket quedó en escucha
+     * @pre Debe llamarse antes de ejecutar()
+     */
+    bool escucharTcp(uint16_t puerto);
+
+    /**
+     * @brief Escucha conexiones en un socket UNIX
+     * @param ruta Ruta del socket (se reemplaza si ya existe)
+     * @return true si el socket quedó en escucha
+     * @pre Debe llamarse antes de ejecutar()
+     */
+    bool escucharUnix(const string& ruta);
+
+    /**
+     * @brief Atiende conexiones hasta que se llame a detener()
+     * @post Bloquea el hilo que la llama mientras los trabajadores corren
+     */
+    void ejecutar();
+
+    /**
+     * @brief Pide a los trabajadores que terminen
+     * @post Puede llamarse desde cualquier hilo
+     */
+    void detener();
+
+    /**
+     * @brief Obtiene el puerto TCP en escucha
+     * @return Puerto, o 0 si no se escucha por TCP
+     */
+    uint16_t obtenerPuertoTcp() const;
+
+    /**
+     * @brief Obtiene el número de hilos trabajadores
+     * @return Número de trabajadores
+     */
+    unsigned obtenerNumTrabajadores() const;
+};
+
+#endif // SERVIDOR_MESAS_H
@@ -0,0 +1,231 @@
+#include "Simulador.h"
+#include "Reglas.h"
+#include <chrono>
+#include <sstream>
+using namespace std;
+
+/**
+ * Suma los contadores de otra simulación
+ * El tiempo se acumula como tiempo total de trabajo
+ */
+void ResultadoSimulacion::combinar(const ResultadoSimulacion& otro) {
+    rondas += otro.rondas;
+    dobladas += otro.dobladas;
+    divisiones += otro.divisiones;
+    rendiciones += otro.rendiciones;
+    manos += otro.manos;
+    victorias += otro.victorias;
+    empates += otro.empates;
+    derrotas += otro.derrotas;
+    blackjacks += otro.blackjacks;
+    totalApostado += otro.totalApostado;
+    gananciaNeta += otro.gananciaNeta;
+    segundos += otro.segundos;
+}
+
+/**
+ * Calcula las manos liquidadas por segundo
+ */
+double ResultadoSimulacion::manosPorSegundo() const {
+    return segundos > 0.0 ? manos / segundos : 0.0;
+}
+
+/**
+ * Calcula el retorno del jugador por unidad apostada
+ */
+double ResultadoSimulacion::retornoPorUnidad() const {
+    return totalApostado > 0 ? static_cast<double>(gananciaNeta) / totalApostado : 0.0;
+}
+
+/**
+ * Resumen legible de la simulación
+ */
+string ResultadoSimulacion::toString() const {
+    stringstream ss;
+    ss << "Rondas: " << rondas << " | Manos: " << manos << "\n"
+       << "Victorias: " << victorias << " | Empates: " << empates
+       << " | Derrotas: " << derrotas << " | Blackjacks: " << blackjacks
+       << " | Dobladas: " << dobladas << " | Divisiones: " << divisiones
+       << " | Rendiciones: " << rendiciones << "\n"
+       << "Ganancia neta: $" << Dinero::formatear(gananciaNeta)
+       << " | Retorno por unidad: " << retornoPorUnidad() * 100.0 << "%\n"
+       << "Tiempo: " << segundos << " s | Manos por segundo: " << manosPorSegundo();
+    return ss.str();
+}
+
+/**
+ * Constructor que prepara el zapato y MAX_MANOS manos por asiento
+ */
+Simulador::Simulador(const ConfiguracionSimulacion& config)
+    : config(config), mazo(config.reglas.numBarajas, config.penetracion),
+      manosJugadores(config.estrategias.size() * MAX_MANOS), apuestas(config.estrategias.size() * MAX_MANOS),
+      manosPorAsiento(config.estrategias.size()), maxManos(config.reglas.manosPermitidas()) {
+    mazo.sembrar(config.semilla);
+}
+
+/**
+ * Siembra de nuevo el zapato
+ */
+void Simulador::sembrar(uint64_t semilla) {
+    config.semilla = semilla;
+    mazo.sembrar(semilla);
+}
+
+/**
+ * Reparte una carta; igual que el Crupier, reinicia el zapato si se agota
+ */
+Carta Simulador::repartir() {
+    if (mazo.estaVacio()) {
+        mazo.reiniciar();
+    }
+    return mazo.repartirCarta();
+}
+
+/**
+ * Ejecuta las rondas pedidas y mide el tiempo
+ * La variante de reglas se elige una sola vez para todas las rondas
+ */
+ResultadoSimulacion Simulador::ejecutar(uint64_t rondas) {
+    ResultadoSimulacion resultado;
+    auto inicio = chrono::steady_clock::now();
+
+    config.reglas.despachar([&](auto reglas) {
+        for (uint64_t i = 0; i < rondas; i++) {
+            jugarRonda<decltype(reglas)>(resultado);
+        }
+    });
+
+    chrono::duration<double> duracion = chrono::steady_clock::now() - inicio;
+    resultado.segundos = duracion.count();
+    return resultado;
+}
+
+/**
+ * Juega las manos del asiento en orden; dividir agrega la nueva mano al
+ * final del asiento, que recibe su segunda carta cuando le toca
+ */
+template <class R>
+bool Simulador::jugarAsiento(size_t asiento, Carta cartaVisible, ResultadoSimulacion& resultado) {
+    const EstrategiaBasica& estrategia = config.estrategias[asiento];
+    Mano* manos = &manosJugadores[asiento * MAX_MANOS];
+    Centavos* apuestasMano = &apuestas[asiento * MAX_MANOS];
+    int numManos = 1;
+    bool quedanManos = false;
+
+    for (int h = 0; h < numManos; h++) {
+        Mano& mano = manos[h];
+        while (!mano.sePaso() && !mano.esBlackjack()) {
+            if (mano.obtenerNumeroCartas() == 1) {
+                mano.agregarCarta(repartir());
+                continue;
+            }
+            const bool dividida = numManos > 1;
+            if (dividida && mano.obtenerCartas()[0].esAs()) {
+                break;  // Los ases divididos reciben una sola carta
+            }
+
+            const bool dosCartas = mano.obtenerNumeroCartas() == 2;
+            Accion accion = estrategia.decidir(mano, cartaVisible, numManos < maxManos,
+                                               R::puedeRendirse(mano.obtenerNumeroCartas(), dividida));
+            bool puedeDoblar = dosCartas && R::puedeDoblar(dividida);
+
+            if (accion == Accion::DIVIDIR) {
+                // La segunda carta pasa a una mano nueva con la misma apuesta
+                Carta primera = mano.obtenerCartas()[0];
+                Carta segunda = mano.obtenerCartas()[1];
+                mano.limpiar();
+                mano.agregarCarta(primera);
+                manos[numManos].limpiar();
+                manos[numManos].agregarCarta(segunda);
+                apuestasMano[numManos] = config.apuesta;
+                numManos++;
+                resultado.divisiones++;
+            } else if (accion == Accion::RENDIRSE) {
+                // Se devuelve media apuesta y el asiento no llega a la liquidación
+                resultado.gananciaNeta += R::calcularRetornoRendicion(apuestasMano[h]) - apuestasMano[h];
+                resultado.totalApostado += apuestasMano[h];
+                resultado.manos++;
+                resultado.derrotas++;
+                resultado.rendiciones++;
+                manosPorAsiento[asiento] = 0;
+                return false;
+            } else if (accion == Accion::PEDIR || (accion == Accion::DOBLAR && !puedeDoblar)) {
+                mano.agregarCarta(repartir());
+            } else if ((accion == Accion::DOBLAR || accion == Accion::DOBLAR_O_PLANTARSE) && puedeDoblar) {
+                // Doblar: se duplica la apuesta y se recibe una sola carta
+                apuestasMano[h] *= 2;
+                mano.agregarCarta(repartir());
+                resultado.dobladas++;
+                break;
+            } else {
+                break;
+            }
+        }
+        quedanManos |= !mano.sePaso();
+    }
+    manosPorAsiento[asiento] = static_cast<uint8_t>(numManos);
+    return quedanManos;
+}
+
+/**
+ * Juega una ronda con el mismo flujo que ControladorJuego::procesarRonda
+ */
+template <class R>
+void Simulador::jugarRonda(ResultadoSimulacion& resultado) {
+    const size_t numAsientos = manosPorAsiento.size();
+
+    // Barajar solo entre rondas, cuando ya salió la carta de corte
+    if (mazo.alcanzoCorte()) {
+        mazo.reiniciar();
+    }
+
+    for (size_t i = 0; i < numAsientos; i++) {
+        manosJugadores[i * MAX_MANOS].limpiar();
+        apuestas[i * MAX_MANOS] = config.apuesta;
+        manosPorAsiento[i] = 1;
+    }
+    manoCrupier.limpiar();
+
+    // Reparto inicial: dos cartas a cada jugador y luego al crupier
+    for (size_t i = 0; i < numAsientos; i++) {
+        manosJugadores[i * MAX_MANOS].agregarCarta(repartir());
+        manosJugadores[i * MAX_MANOS].agregarCarta(repartir());
+    }
+    manoCrupier.agregarCarta(repartir());
+    manoCrupier.agregarCarta(repartir());
+    const Carta cartaVisible = manoCrupier.obtenerCartas()[0];
+
+    // Con revisión y Blackjack del crupier se liquida sin jugar: solo se pierde la apuesta inicial
+    if (!manoCrupier.esBlackjack() || !config.reglas.crupierRevisaBlackjack) {
+        bool hayManosEnJuego = false;
+        for (size_t i = 0; i < numAsientos; i++) {
+            hayManosEnJuego |= jugarAsiento<R>(i, cartaVisible, resultado);
+        }
+
+        if (hayManosEnJuego) {
+            while (R::crupierDebePedir(manoCrupier)) {
+                manoCrupier.agregarCarta(repartir());
+            }
+        }
+    }
+
+    // Liquidación
+    for (size_t i = 0; i < numAsientos; i++) {
+        const int numManos = manosPorAsiento[i];
+        const bool dividida = numManos > 1;
+        for (int h = 0; h < numManos; h++) {
+            const Mano& mano = manosJugadores[i * MAX_MANOS + h];
+            const Centavos apuesta = apuestas[i * MAX_MANOS + h];
+            int comparacion = Reglas::compararManos(mano, manoCrupier, dividida);
+            bool esBlackjack = mano.esBlackjack() && !dividida;
+            resultado.gananciaNeta += R::calcularRetorno(comparacion, esBlackjack, apuesta) - apuesta;
+            resultado.totalApostado += apuesta;
+            resultado.victorias += comparacion > 0;
+            resultado.empates += comparacion == 0;
+            resultado.derrotas += comparacion < 0;
+            resultado.blackjacks += esBlackjack;
+        }
+        resultado.manos += numManos;
+    }
+    resultado.rondas++;
+}
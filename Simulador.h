@@ -0,0 +1,145 @@
+#ifndef SIMULADOR_H
+#define SIMULADOR_H
+
+#include "ConjuntoReglas.h"
+#include "Dinero.h"
+#include "Mazo.h"
+#include "Mano.h"
+#include "EstrategiaBasica.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * @struct ConfiguracionSimulacion
+ * @brief Parámetros de una simulación sin interfaz
+ */
+struct ConfiguracionSimulacion {
+    ConfiguracionReglas reglas;         ///< Variante de reglas, incluidas las barajas del zapato
+    double penetracion = 0.75;          ///< Penetración de la carta de corte
+    uint64_t semilla = 1;               ///< Semilla del zapato
+    Centavos apuesta = Dinero::desdeDolares(10);  ///< Apuesta fija por mano, en centavos
+    vector<EstrategiaBasica> estrategias;  ///< Estrategia de cada asiento (uno por jugador)
+};
+
+/**
+ * @struct ResultadoSimulacion
+ * @brief Resultados agregados de una simulación
+ */
+struct ResultadoSimulacion {
+    uint64_t rondas = 0;         ///< Rondas jugadas
+    uint64_t manos = 0;          ///< Manos de jugador liquidadas
+    uint64_t victorias = 0;      ///< Manos ganadas por el jugador
+    uint64_t empates = 0;        ///< Manos empatadas
+    uint64_t derrotas = 0;       ///< Manos perdidas
+    uint64_t blackjacks = 0;     ///< Blackjacks del jugador
+    uint64_t dobladas = 0;       ///< Manos en las que se dobló la apuesta
+    uint64_t divisiones = 0;     ///< Parejas divididas
+    uint64_t rendiciones = 0;    ///< Manos rendidas (contadas también como derrotas)
+    Centavos totalApostado = 0;  ///< Suma de todas las apuestas, en centavos
+    Centavos gananciaNeta = 0;   ///< Ganancia neta del jugador en centavos (negativa si pierde)
+    double segundos = 0.0;       ///< Tiempo de ejecución
+
+    /**
+     * @brief Acumula los resultados de otra simulación
+     * @param otro Resultados a sumar
+     */
+    void combinar(const ResultadoSimulacion& otro);
+
+    /**
+     * @brief Calcula el rendimiento de la simulación
+     * @return Manos liquidadas por segundo
+     */
+    double manosPorSegundo() const;
+
+    /**
+     * @brief Calcula el retorno medio del jugador por unidad apostada
+     * @return Ganancia neta / total apostado
+     */
+    double retornoPorUnidad() const;
+
+    /**
+     * @brief Convierte los resultados a string para mostrar
+     * @return Resumen legible de la simulación
+     */
+    string toString() const;
+};
+
+/**
+ * @class Simulador
+ * @brief Motor de rondas sin interfaz para análisis Monte Carlo
+ *
+ * Juega rondas completas con el mismo orden de reparto que ControladorJuego,
+ * pero sin entrada/salida ni pausas. Cada asiento decide leyendo su tabla
+ * de EstrategiaBasica y puede doblar, dividir (los ases divididos reciben
+ * una sola carta) y rendirse según config.reglas. Con revisión el crupier
+ * mira si tiene Blackjack antes de que jueguen los asientos; sin ella los
+ * asientos juegan y su Blackjack gana también a lo doblado y dividido.
+ *
+ * La ronda es una plantilla sobre ConjuntoReglas: ejecutar() elige la
+ * variante una vez y todas las rondas corren sin consultar reglas. Cada
+ * asiento tiene MAX_MANOS manos fijas que se reutilizan entre rondas, por
+ * lo que dividir no reserva memoria.
+ */
+class Simulador {
+private:
+    ConfiguracionSimulacion config;  ///< Configuración de la simulación
+    Mazo mazo;                       ///< Zapato propio del simulador
+    vector<Mano> manosJugadores;     ///< Manos de cada asiento: MAX_MANOS por asiento, contiguas
+    vector<Centavos> apuestas;       ///< Apuesta de cada mano en la ronda actual
+    vector<uint8_t> manosPorAsiento; ///< Manos por liquidar de cada asiento (0 si se rindió)
+    Mano manoCrupier;                ///< Mano del crupier
+    int maxManos;                    ///< Límite de manos por asiento de la variante
+
+    /**
+     * @brief Reparte una carta, reiniciando el zapato si se agotó
+     * @return Carta repartida
+     */
+    Carta repartir();
+
+    /**
+     * @brief Juega una ronda completa y acumula su resultado
+     * @tparam R ConjuntoReglas de la variante
+     * @param resultado Resultados donde se acumula la ronda
+     */
+    template <class R>
+    void jugarRonda(ResultadoSimulacion& resultado);
+
+    /**
+     * @brief Juega las manos de un asiento hasta que todas terminan
+     * @tparam R ConjuntoReglas de la variante
+     * @param asiento Índice del asiento
+     * @param cartaVisible Carta descubierta del crupier
+     * @param resultado Resultados donde se acumulan dobladas, divisiones y rendiciones
+     * @return true si al asiento le queda alguna mano sin pasarse
+     */
+    template <class R>
+    bool jugarAsiento(size_t asiento, Carta cartaVisible, ResultadoSimulacion& resultado);
+
+public:
+    static constexpr int MAX_MANOS = ConfiguracionReglas::MAX_MANOS;
+
+
+    /**
+     * @brief Constructor de la clase Simulador
+     * @param config Configuración de la simulación
+     * @post Crea el zapato sembrado con config.semilla
+     */
+    explicit Simulador(const ConfiguracionSimulacion& config);
+
+    /**
+     * @brief Ejecuta un número de rondas
+     * @param rondas Número de rondas a jugar
+     * @return Resultados agregados, incluido el tiempo de ejecución
+     */
+    ResultadoSimulacion ejecutar(uint64_t rondas);
+
+    /**
+     * @brief Siembra de nuevo el zapato del simulador
+     * @param semilla Nueva semilla
+     */
+    void sembrar(uint64_t semilla);
+};
+
+#endif // SIMULADOR_H
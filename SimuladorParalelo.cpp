@@ -0,0 +1,113 @@
+#include "SimuladorParalelo.h"
+#include "GeneradorAleatorio.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+namespace {
+    /**
+     * Cola de lotes de un hilo. El dueño toma lotes del frente y los
+     * ladrones del final, para que compitan lo menos posible
+     */
+    struct ColaLotes {
+        mutex cerrojo;
+        deque<uint64_t> lotes;
+
+        bool tomarFrente(uint64_t& lote) {
+            lock_guard<mutex> guardia(cerrojo);
+            if (lotes.empty()) return false;
+            lote = lotes.front();
+            lotes.pop_front();
+            return true;
+        }
+
+        bool robarFinal(uint64_t& lote) {
+            lock_guard<mutex> guardia(cerrojo);
+            if (lotes.empty()) return false;
+            lote = lotes.back();
+            lotes.pop_back();
+            return true;
+        }
+    };
+}
+
+/**
+ * Constructor que fija el número de hilos y el tamaño de lote
+ */
+SimuladorParalelo::SimuladorParalelo(const ConfiguracionSimulacion& config, unsigned numHilos,
+                                     uint64_t rondasPorLote)
+    : config(config),
+      numHilos(numHilos > 0 ? numHilos : max(1u, thread::hardware_concurrency())),
+      rondasPorLote(max<uint64_t>(1, rondasPorLote)) {}
+
+/**
+ * Deriva la semilla de un lote mezclando la semilla base con su número
+ */
+uint64_t SimuladorParalelo::semillaDeLote(uint64_t semillaBase, uint64_t lote) {
+    uint64_t estado = semillaBase ^ (lote * 0xD1B54A32D192ED03ULL);
+    return GeneradorAleatorio::splitMix64(estado);
+}
+
+/**
+ * Getter para el número de hilos
+ */
+unsigned SimuladorParalelo::obtenerNumHilos() const {
+    return numHilos;
+}
+
+/**
+ * Ejecuta todos los lotes con robo de trabajo y reduce en orden
+ */
+ResultadoSimulacion SimuladorParalelo::ejecutar(uint64_t rondas) {
+    const uint64_t numLotes = (rondas + rondasPorLote - 1) / rondasPorLote;
+    const unsigned hilosUsados = static_cast<unsigned>(min<uint64_t>(numHilos, max<uint64_t>(1, numLotes)));
+    vector<ResultadoSimulacion> resultadosLote(numLotes);
+    vector<ColaLotes> colas(hilosUsados);
+
+    // Reparto inicial en bloques contiguos
+    for (uint64_t lote = 0; lote < numLotes; lote++) {
+        colas[lote * hilosUsados / numLotes].lotes.push_back(lote);
+    }
+
+    auto inicio = chrono::steady_clock::now();
+
+    auto trabajar = [&](unsigned id) {
+        Simulador simulador(config);
+        uint64_t lote;
+        for (;;) {
+            bool hayLote = colas[id].tomarFrente(lote);
+            for (unsigned paso = 1; !hayLote && paso < hilosUsados; paso++) {
+                hayLote = colas[(id + paso) % hilosUsados].robarFinal(lote);
+            }
+            if (!hayLote) {
+                return;  // Ninguna cola tiene trabajo pendiente
+            }
+
+            uint64_t rondasLote = min(rondasPorLote, rondas - lote * rondasPorLote);
+            simulador.sembrar(semillaDeLote(config.semilla, lote));
+            resultadosLote[lote] = simulador.ejecutar(rondasLote);
+        }
+    };
+
+    vector<thread> hilos;
+    for (unsigned id = 1; id < hilosUsados; id++) {
+        hilos.emplace_back(trabajar, id);
+    }
+    trabajar(0);
+    for (thread& hilo : hilos) {
+        hilo.join();
+    }
+
+    // Reducción determinista en orden de lote
+    ResultadoSimulacion total;
+    for (const ResultadoSimulacion& parcial : resultadosLote) {
+        total.combinar(parcial);
+    }
+    chrono::duration<double> duracion = chrono::steady_clock::now() - inicio;
+    total.segundos = duracion.count();
+    return total;
+}
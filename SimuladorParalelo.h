@@ -0,0 +1,59 @@
+#ifndef SIMULADOR_PARALELO_H
+#define SIMULADOR_PARALELO_H
+
+#include "Simulador.h"
+#include <cstdint>
+using namespace std;
+
+/**
+ * @class SimuladorParalelo
+ * @brief Reparte una simulación en lotes de rondas entre varios hilos
+ *
+ * Cada hilo tiene su propio Simulador (y por tanto su propio zapato y
+ * generador). Los lotes se reparten al inicio en colas por hilo; un hilo
+ * sin trabajo roba lotes del final de la cola de otro. Cada lote siembra
+ * el zapato con una semilla derivada de su número, así que el resultado no
+ * depende de qué hilo lo ejecutó, y la reducción final se hace en orden de
+ * lote para que sea determinista.
+ */
+class SimuladorParalelo {
+private:
+    ConfiguracionSimulacion config;  ///< Configuración común a todos los hilos
+    unsigned numHilos;               ///< Número de hilos de trabajo
+    uint64_t rondasPorLote;          ///< Tamaño de cada lote
+
+public:
+    /**
+     * @brief Constructor de la clase SimuladorParalelo
+     * @param config Configuración de la simulación
+     * @param numHilos Hilos a usar (0 = todos los núcleos disponibles)
+     * @param rondasPorLote Rondas por lote de trabajo
+     */
+    SimuladorParalelo(const ConfiguracionSimulacion& config, unsigned numHilos = 0,
+                      uint64_t rondasPorLote = 100000);
+
+    /**
+     * @brief Ejecuta la simulación completa
+     * @param rondas Número total de rondas
+     * @return Resultados reducidos; segundos es el tiempo real transcurrido
+     * @post Con la misma configuración y semilla el resultado es idéntico
+     *       sin importar el número de hilos
+     */
+    ResultadoSimulacion ejecutar(uint64_t rondas);
+
+    /**
+     * @brief Calcula la semilla de un lote
+     * @param semillaBase Semilla de la simulación
+     * @param lote Número de lote
+     * @return Semilla independiente para el lote
+     */
+    static uint64_t semillaDeLote(uint64_t semillaBase, uint64_t lote);
+
+    /**
+     * @brief Obtiene el número de hilos configurado
+     * @return Número de hilos de trabajo
+     */
+    unsigned obtenerNumHilos() const;
+};
+
+#endif // SIMULADOR_PARALELO_H
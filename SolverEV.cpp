@@ -0,0 +1,289 @@
+#include "SolverEV.h"
+#include <algorithm>
+#include <vector>
+using namespace std;
+
+namespace {
+    inline int valorMano(int totalDuro, bool tieneAs) {
+        return (tieneAs && totalDuro <= 11) ? totalDuro + 10 : totalDuro;
+    }
+
+    /**
+     * EV de plantarse con un valor (no Blackjack) contra una distribución
+     * Con menos de 17 el jugador solo gana si el crupier se pasa
+     */
+    double evContra(int valor, const DistribucionCrupier& crupier) {
+        double ev = crupier.probabilidadPasarse() - crupier.probabilidadBlackjack();
+        for (int total = 17; total <= 21; total++) {
+            if (valor > total) ev += crupier.probabilidadTotal(total);
+            else if (valor < total) ev -= crupier.probabilidadTotal(total);
+        }
+        return ev;
+    }
+
+    inline int totalCartas(const Composicion& restantes) {
+        int total = 0;
+        for (uint16_t cantidad : restantes) {
+            total += cantidad;
+        }
+        return total;
+    }
+
+    /**
+     * Mano representativa (índices de valor) de cada fila de la tabla
+     * Se evitan parejas y Ases en las filas duras cuando es posible
+     */
+    vector<int> manoRepresentativa(int fila) {
+        if (fila >= EstrategiaBasica::FILA_PARES) {
+            int valor = fila - EstrategiaBasica::FILA_PARES;
+            return {valor, valor};
+        }
+        if (fila >= EstrategiaBasica::FILA_SUAVES) {
+            int total = 12 + fila - EstrategiaBasica::FILA_SUAVES;
+            return total == 12 ? vector<int>{0, 0} : vector<int>{0, total - 12};
+        }
+        int total = 4 + fila - EstrategiaBasica::FILA_DURAS;
+        if (total == 4) return {1, 1};
+        if (total <= 11) return {1, total - 3};
+        if (total <= 19) return {9, total - 11};
+        return {9, total - 13, 1};  // 20 = 10+8+2, 21 = 10+9+2
+    }
+}
+
+/**
+ * Mejor acción entre las legales
+ */
+Accion ValoresAccion::mejorAccion() const {
+    Accion mejor = pedir > plantarse ? Accion::PEDIR : Accion::PLANTARSE;
+    double valor = max(pedir, plantarse);
+    if (puedeDoblar && doblar > valor) {
+        mejor = pedir > plantarse ? Accion::DOBLAR : Accion::DOBLAR_O_PLANTARSE;
+        valor = doblar;
+    }
+    if (puedeDividir && dividir > valor) {
+        mejor = Accion::DIVIDIR;
+    }
+    return mejor;
+}
+
+/**
+ * Valor esperado de la mejor acción legal
+ */
+double ValoresAccion::mejorValor() const {
+    double valor = max(pedir, plantarse);
+    if (puedeDoblar) valor = max(valor, doblar);
+    if (puedeDividir) valor = max(valor, dividir);
+    return valor;
+}
+
+/**
+ * Constructor que fija la variante y el modo de evaluación del crupier
+ */
+SolverEV::SolverEV(const ConfiguracionReglas& reglas, bool crupierExacto)
+    : reglas(reglas), probabilidadCrupier(reglas), crupierExacto(crupierExacto) {}
+
+/**
+ * EV de plantarse con un valor (no Blackjack) contra la distribución del crupier
+ */
+double SolverEV::valorPlantarse(int valor, int indiceVisible, const Composicion& restantes) {
+    if (!crupierExacto) {
+        return evPlantarseRaiz[valor];
+    }
+
+    return evContra(valor, probabilidadCrupier.calcular(indiceVisible, restantes));
+}
+
+/**
+ * EV de jugar de forma óptima (plantarse o pedir), memorizado
+ */
+double SolverEV::valorJugar(Composicion& restantes, int totalDuro, bool tieneAs, int indiceVisible) {
+    ClaveComposicion clave{claveRestantes,
+                           static_cast<uint16_t>((totalDuro << 5) | (tieneAs << 4) | indiceVisible)};
+    auto encontrado = memoJugar.find(clave);
+    if (encontrado != memoJugar.end()) {
+        return encontrado->second;
+    }
+
+    int valor = valorMano(totalDuro, tieneAs);
+    double ev = valorPlantarse(valor, indiceVisible, restantes);
+    if (valor < 21) {
+        ev = max(ev, valorPedir(restantes, totalDuro, tieneAs, indiceVisible));
+    }
+
+    memoJugar.emplace(clave, ev);
+    return ev;
+}
+
+/**
+ * EV de pedir una carta y seguir jugando de forma óptima
+ */
+double SolverEV::valorPedir(Composicion& restantes, int totalDuro, bool tieneAs, int indiceVisible) {
+    int total = totalCartas(restantes);
+    if (total == 0) {
+        return valorPlantarse(valorMano(totalDuro, tieneAs), indiceVisible, restantes);
+    }
+
+    double ev = 0.0;
+    for (int indice = 0; indice < Carta::NUM_VALORES; indice++) {
+        if (restantes[indice] == 0) continue;
+
+        double probabilidad = static_cast<double>(restantes[indice]) / total;
+        int nuevoTotal = totalDuro + indice + 1;
+        if (nuevoTotal > 21) {
+            ev -= probabilidad;
+            continue;
+        }
+        quitar(restantes, indice);
+        ev += probabilidad * valorJugar(restantes, nuevoTotal, tieneAs || indice == 0, indiceVisible);
+        devolver(restantes, indice);
+    }
+    return ev;
+}
+
+/**
+ * EV de doblar: una sola carta más con la apuesta duplicada
+ */
+double SolverEV::valorDoblar(Composicion& restantes, int totalDuro, bool tieneAs, int indiceVisible) {
+    int total = totalCartas(restantes);
+    double ev = 0.0;
+    for (int indice = 0; indice < Carta::NUM_VALORES && total > 0; indice++) {
+        if (restantes[indice] == 0) continue;
+
+        double probabilidad = static_cast<double>(restantes[indice]) / total;
+        int nuevoTotal = totalDuro + indice + 1;
+        if (nuevoTotal > 21) {
+            ev -= probabilidad;
+            continue;
+        }
+        quitar(restantes, indice);
+        ev += probabilidad * valorPlantarse(valorMano(nuevoTotal, tieneAs || indice == 0),
+                                            indiceVisible, restantes);
+        devolver(restantes, indice);
+    }
+    return 2.0 * ev;
+}
+
+/**
+ * EV de dividir: dos manos independientes que empiezan con la carta de la pareja
+ */
+double SolverEV::valorDividir(Composicion& restantes, int indicePar, int indiceVisible) {
+    int total = totalCartas(restantes);
+    const bool sonAses = indicePar == 0;
+    double evMano = 0.0;
+
+    for (int indice = 0; indice < Carta::NUM_VALORES && total > 0; indice++) {
+        if (restantes[indice] == 0) continue;
+
+        double probabilidad = static_cast<double>(restantes[indice]) / total;
+        int totalDuro = (indicePar + 1) + (indice + 1);
+        bool tieneAs = sonAses || indice == 0;
+        quitar(restantes, indice);
+        double ev;
+        if (sonAses) {
+            // Los Ases divididos reciben una sola carta
+            ev = valorPlantarse(valorMano(totalDuro, tieneAs), indiceVisible, restantes);
+        } else {
+            ev = valorJugar(restantes, totalDuro, tieneAs, indiceVisible);
+            if (reglas.doblarTrasDividir) {
+                ev = max(ev, valorDoblar(restantes, totalDuro, tieneAs, indiceVisible));
+            }
+        }
+        devolver(restantes, indice);
+        evMano += probabilidad * ev;
+    }
+    return 2.0 * evMano;
+}
+
+/**
+ * Evalúa todas las acciones legales de una mano concreta
+ */
+ValoresAccion SolverEV::evaluar(const Mano& mano, Carta cartaVisibleCrupier, const Composicion& restantes) {
+    ValoresAccion valores;
+    Composicion copia = restantes;
+    int indiceVisible = cartaVisibleCrupier.obtenerIndiceValor();
+    int valor = mano.calcularValor();
+    int totalDuro = mano.esSuave() ? valor - 10 : valor;
+    bool tieneAs = false;
+    for (const Carta& carta : mano.obtenerCartas()) {
+        tieneAs |= carta.esAs();
+    }
+
+    if (!crupierExacto) {
+        // Los valores memorizados dependen de la distribución de esta raíz
+        distribucionRaiz = probabilidadCrupier.calcular(indiceVisible, copia);
+        for (int v = 0; v <= 21; v++) {
+            evPlantarseRaiz[v] = evContra(v, distribucionRaiz);
+        }
+        memoJugar.clear();
+    }
+    claveRestantes = ClaveComposicion::empaquetar(copia);
+
+    if (mano.esBlackjack()) {
+        // Blackjack: se paga según la variante salvo que el crupier también tenga Blackjack
+        DistribucionCrupier crupier = probabilidadCrupier.calcular(indiceVisible, copia);
+        double factorBlackjack = static_cast<double>(reglas.numeradorBlackjack()) / reglas.denominadorBlackjack();
+        valores.plantarse = factorBlackjack * (1.0 - crupier.probabilidadBlackjack());
+        valores.pedir = valores.plantarse;
+        return valores;
+    }
+
+    valores.plantarse = valor > 21 ? -1.0 : valorPlantarse(valor, indiceVisible, copia);
+    valores.pedir = valor >= 21 ? valores.plantarse - 1.0 : valorPedir(copia, totalDuro, tieneAs, indiceVisible);
+    valores.puedeDoblar = mano.obtenerNumeroCartas() == 2;
+    if (valores.puedeDoblar) {
+        valores.doblar = valorDoblar(copia, totalDuro, tieneAs, indiceVisible);
+    }
+    valores.puedeDividir = mano.esPar() && reglas.manosPermitidas() > 1;
+    if (valores.puedeDividir) {
+        valores.dividir = valorDividir(copia, mano.obtenerCartas()[0].obtenerIndiceValor(), indiceVisible);
+    }
+    return valores;
+}
+
+/**
+ * Resuelve cada celda de la tabla con una mano representativa
+ */
+EstrategiaBasica SolverEV::generarTabla(const Composicion& zapato) {
+    EstrategiaBasica estrategia;
+
+    for (int fila = 0; fila < EstrategiaBasica::NUM_FILAS; fila++) {
+        vector<int> cartas = manoRepresentativa(fila);
+
+        for (int visible = 0; visible < Carta::NUM_VALORES; visible++) {
+            Composicion restantes = zapato;
+            Mano mano;
+            bool posible = restantes[visible] > 0;
+            if (posible) restantes[visible]--;
+            for (int indice : cartas) {
+                posible = posible && restantes[indice] > 0;
+                if (!posible) break;
+                quitar(restantes, indice);
+                // El índice de valor 9 se representa con un 10; el resto con su rango
+                mano.agregarCarta(Carta(static_cast<uint8_t>(indice), 0));
+            }
+            if (!posible) continue;  // Se conserva la acción por defecto
+
+            ValoresAccion valores = evaluar(mano, Carta(static_cast<uint8_t>(visible), 0), restantes);
+            if (fila < EstrategiaBasica::FILA_PARES) {
+                valores.puedeDividir = false;
+            }
+            estrategia.establecerAccion(fila, visible, valores.mejorAccion());
+        }
+    }
+    return estrategia;
+}
+
+/**
+ * Vacía las memorias del jugador y del crupier
+ */
+void SolverEV::limpiarCache() {
+    memoJugar.clear();
+    probabilidadCrupier.limpiarCache();
+}
+
+/**
+ * Getter del tamaño de la memoria del jugador
+ */
+size_t SolverEV::tamanoCache() const {
+    return memoJugar.size();
+}
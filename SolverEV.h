@@ -0,0 +1,132 @@
+#ifndef SOLVER_EV_H
+#define SOLVER_EV_H
+
+#include "ProbabilidadCrupier.h"
+#include "EstrategiaBasica.h"
+#include "Mano.h"
+#include <unordered_map>
+using namespace std;
+
+/**
+ * @struct ValoresAccion
+ * @brief Valor esperado (en unidades de apuesta) de cada acción legal
+ */
+struct ValoresAccion {
+    double plantarse = 0.0;     ///< EV de plantarse
+    double pedir = 0.0;         ///< EV de pedir y seguir jugando de forma óptima
+    double doblar = 0.0;        ///< EV de doblar (recibir una carta con apuesta doble)
+    double dividir = 0.0;       ///< EV de dividir la pareja
+    bool puedeDoblar = false;   ///< true si doblar es legal (dos cartas)
+    bool puedeDividir = false;  ///< true si dividir es legal (pareja)
+
+    /**
+     * @brief Obtiene la mejor acción legal
+     * @return Acción con mayor valor esperado
+     */
+    Accion mejorAccion() const;
+
+    /**
+     * @brief Obtiene el valor esperado de la mejor acción legal
+     * @return Mayor valor esperado
+     */
+    double mejorValor() const;
+};
+
+/**
+ * @class SolverEV
+ * @brief Calcula el valor esperado exacto de cada acción según la composición
+ *
+ * Usa las mismas reglas que Mano y Reglas::compararManos(), con la regla
+ * del crupier, el pago del Blackjack y doblar tras dividir de la variante.
+ * El Blackjack del crupier gana a cualquier 21 del jugador. Si el crupier
+ * revisa su carta oculta (por defecto), los valores están condicionados a
+ * que no tenga Blackjack, que es cuando el jugador llega a decidir; sin
+ * revisión también gana a las manos dobladas o divididas.
+ * Al pedir, cada carta se quita de la composición. Los valores de seguir
+ * jugando se memorizan por (composición, total, As, carta visible).
+ *
+ * Con crupierExacto el crupier se evalúa con ProbabilidadCrupier sobre la
+ * composición de cada nodo, lo que es exacto pero cuesta segundos por
+ * tabla. Por defecto la distribución del crupier se calcula una vez con la
+ * composición después del reparto inicial (aproximación habitual que solo
+ * ignora el efecto de las cartas que pide el jugador sobre el crupier), y
+ * una tabla completa se resuelve en milisegundos.
+ *
+ * Al dividir se juega una sola división (sin redividir) y cada mano se
+ * evalúa de forma independiente con la composición después de la división,
+ * doblando si la variante lo permite; los Ases divididos reciben una sola
+ * carta. Con un límite de una mano no se divide.
+ */
+class SolverEV {
+private:
+    ConfiguracionReglas reglas;               ///< Variante que se resuelve
+    ProbabilidadCrupier probabilidadCrupier;  ///< Motor de distribución del crupier
+    bool crupierExacto;                       ///< Recalcular el crupier en cada nodo
+    DistribucionCrupier distribucionRaiz;     ///< Crupier tras el reparto (modo aproximado)
+    array<double, 22> evPlantarseRaiz{};      ///< EV de plantarse por valor (modo aproximado)
+    uint64_t claveRestantes = 0;              ///< Composición empaquetada del nodo actual
+
+    /**
+     * @brief Quita una carta de la composición y de su clave empaquetada
+     */
+    void quitar(Composicion& restantes, int indice) {
+        restantes[indice]--;
+        claveRestantes -= ClaveComposicion::unidad(indice);
+    }
+
+    /**
+     * @brief Devuelve una carta a la composición y a su clave empaquetada
+     */
+    void devolver(Composicion& restantes, int indice) {
+        restantes[indice]++;
+        claveRestantes += ClaveComposicion::unidad(indice);
+    }
+    /// Valor de seguir jugando de forma óptima (plantarse o pedir)
+    unordered_map<ClaveComposicion, double, HashClaveComposicion> memoJugar;
+
+    double valorPlantarse(int valor, int indiceVisible, const Composicion& restantes);
+    double valorJugar(Composicion& restantes, int totalDuro, bool tieneAs, int indiceVisible);
+    double valorPedir(Composicion& restantes, int totalDuro, bool tieneAs, int indiceVisible);
+    double valorDoblar(Composicion& restantes, int totalDuro, bool tieneAs, int indiceVisible);
+    double valorDividir(Composicion& restantes, int indicePar, int indiceVisible);
+
+public:
+    /**
+     * @brief Constructor de la clase SolverEV
+     * @param reglas Variante; se usan H17, revisión, pago, doblar tras dividir y límite de manos
+     * @param crupierExacto true para recalcular el crupier con la composición de cada nodo
+     */
+    explicit SolverEV(const ConfiguracionReglas& reglas = ConfiguracionReglas(), bool crupierExacto = false);
+
+    /**
+     * @brief Evalúa todas las acciones legales de una mano
+     * @param mano Mano del jugador
+     * @param cartaVisibleCrupier Carta descubierta del crupier
+     * @param restantes Zapato restante, sin las cartas del jugador ni la visible
+     * @return Valor esperado de cada acción; con revisión, sabiendo que el
+     *         crupier no tiene Blackjack
+     */
+    ValoresAccion evaluar(const Mano& mano, Carta cartaVisibleCrupier, const Composicion& restantes);
+
+    /**
+     * @brief Genera una tabla de estrategia completa para una composición
+     * @param zapato Composición del zapato antes de repartir
+     * @return Estrategia con la mejor acción de cada celda
+     * @post Cada celda se resuelve quitando del zapato una mano representativa
+     *       y la carta visible del crupier
+     */
+    EstrategiaBasica generarTabla(const Composicion& zapato);
+
+    /**
+     * @brief Vacía las memorias del solver y del motor del crupier
+     */
+    void limpiarCache();
+
+    /**
+     * @brief Obtiene el número de estados memorizados por el solver
+     * @return Tamaño de la memoria del jugador
+     */
+    size_t tamanoCache() const;
+};
+
+#endif // SOLVER_EV_H
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <string>
 #include "ControladorJuego.h"
+#include "SimuladorParalelo.h"
+#include "ServidorMesas.h"
 using namespace std;
 
 // Declaración de la función de pruebas (definida en PruebasUnitarias.cpp)
@@ -15,7 +17,9 @@ int main()
     cout << "========================================" << endl;
     cout << "1. Jugar Blackjack" << endl;
     cout << "2. Ejecutar Pruebas Unitarias" << endl;
-    cout << "3. Salir" << endl;
+    cout << "3. Simulación sin interfaz" << endl;
+    cout << "4. Servidor de mesas" << endl;
+    cout << "5. Salir" << endl;
     cout << "Selecciona una opción: ";
     cin >> opcion;
     cin.ignore(); // Limpiar buffer
@@ -34,7 +38,44 @@ int main()
             system("./pruebas");
             break;
         }
-        case 3:
+        case 3: {
+            int numJugadores;
+            long long rondas;
+            cout << "Número de jugadores (1-7): ";
+            cin >> numJugadores;
+            cout << "Número de rondas: ";
+            cin >> rondas;
+            if (numJugadores < 1 || numJugadores > 7) numJugadores = 1;
+            if (rondas < 1) rondas = 1000000;
+
+            ConfiguracionSimulacion config;
+            config.estrategias.assign(numJugadores, EstrategiaBasica());
+            SimuladorParalelo simulador(config);
+            cout << "Simulando " << rondas << " rondas en "
+                 << simulador.obtenerNumHilos() << " hilos (" << config.reglas.describir() << ")..." << endl;
+            cout << simulador.ejecutar(rondas).toString() << endl;
+            break;
+        }
+        case 4: {
+            int puerto;
+            cout << "Puerto TCP (0 = cualquiera libre): ";
+            cin >> puerto;
+            if (puerto < 0 || puerto > 65535) puerto = 0;
+
+            ServidorMesas servidor;
+            if (!servidor.escucharTcp(static_cast<uint16_t>(puerto))) {
+                cout << "No se pudo abrir el puerto " << puerto << endl;
+                break;
+            }
+            servidor.escucharUnix("blackjack.sock");
+            cout << "Servidor en 127.0.0.1:" << servidor.obtenerPuertoTcp()
+                 << " y blackjack.sock con " << servidor.obtenerNumTrabajadores()
+                 << " hilos. Protocolo: MESA <n> <nombre>, APOSTAR <x>, PEDIR, PLANTARSE, "
+                 << "DOBLAR, DIVIDIR, RENDIRSE, SEGURO, NO_SEGURO, SALIR" << endl;
+            servidor.ejecutar();
+            break;
+        }
+        case 5:
             cout << "¡Hasta luego!" << endl;
             break;
         default: